@@ -12,7 +12,13 @@ int main()
     r.push_back( std::make_unique<Widget>() );
     r.push_back( std::make_unique<Widget>() );
 
+#if nsrs_RING_SPAN_LITE_EXTENSION
+    // release the widgets now, not when their slots are overwritten:
+
+    r.clear();
+#else
     r = nonstd::ring_span< std::unique_ptr<Widget> >( v.begin(), v.end() );
+#endif
 }
 
 // g++ -std=c++14 -Wall -I../include -o 04-clear.exe 04-clear.cpp && 04-clear.exe
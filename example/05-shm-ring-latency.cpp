@@ -0,0 +1,127 @@
+// example/05-shm-ring-latency.cpp
+// Two-process ping-pong latency over a pair of shared memory rings.
+
+#include "nonstd/ring_shm.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_SHM_RING
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using nonstd::shm_ring;
+
+struct message
+{
+    std::uint64_t seq;
+    std::int64_t  stamp;
+    char          payload[48];
+};
+
+inline void relax( unsigned & spins )
+{
+    if ( ++spins > 1000 ) { spins = 0; ::sched_yield(); }
+}
+
+inline void send( shm_ring<message> & ring, message const & msg )
+{
+    for ( unsigned spins = 0; !ring.try_push( msg ); )
+        relax( spins );
+}
+
+inline void receive( shm_ring<message> & ring, message & msg )
+{
+    for ( unsigned spins = 0; !ring.try_pop( msg ); )
+        relax( spins );
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const count = argc > 1 ? std::max( std::stoul( argv[1] ), 1ul ) : 100000;
+
+    std::ostringstream os; os << "/nsrs-latency-" << ::getpid();
+    std::string const ping_name = os.str() + "-ping";
+    std::string const pong_name = os.str() + "-pong";
+
+    shm_ring<message> ping;
+    shm_ring<message> pong;
+
+    if ( ping.create( ping_name.c_str(), 1024 ) != 0 || pong.create( pong_name.c_str(), 1024 ) != 0 )
+    {
+        std::cerr << "cannot create shared memory rings\n";
+        return 1;
+    }
+
+    pid_t const pid = ::fork();
+
+    if ( pid == 0 )
+    {
+        // echo process: attach by name, so that the rings may be mapped elsewhere:
+
+        shm_ring<message> in;
+        shm_ring<message> out;
+
+        if ( in.attach( ping_name.c_str() ) != 0 || out.attach( pong_name.c_str() ) != 0 )
+            ::_exit( 1 );
+
+        message msg;
+        for ( std::size_t i = 0; i < count; ++i )
+        {
+            receive( in, msg );
+            send( out, msg );
+        }
+        ::_exit( 0 );
+    }
+
+    typedef std::chrono::steady_clock clock;
+
+    std::vector<std::int64_t> rtt( count );
+    message msg = message();
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        msg.seq   = i;
+        msg.stamp = std::chrono::duration_cast<std::chrono::nanoseconds>( clock::now().time_since_epoch() ).count();
+
+        send( ping, msg );
+        receive( pong, msg );
+
+        rtt[i] = std::chrono::duration_cast<std::chrono::nanoseconds>( clock::now().time_since_epoch() ).count() - msg.stamp;
+    }
+
+    int status = 0;
+    ::waitpid( pid, &status, 0 );
+
+    shm_ring<message>::unlink( ping_name.c_str() );
+    shm_ring<message>::unlink( pong_name.c_str() );
+
+    std::sort( rtt.begin(), rtt.end() );
+
+    std::cout
+        << "round trips: " << count << " of " << sizeof(message) << " bytes\n"
+        << "one-way latency [ns]:"
+        << " p50: "   << rtt[ count / 2 ] / 2
+        << " p99: "   << rtt[ count * 99 / 100 ] / 2
+        << " p99.9: " << rtt[ count * 999 / 1000 ] / 2
+        << " max: "   << rtt.back() / 2 << "\n";
+
+    return WIFEXITED( status ) && WEXITSTATUS( status ) == 0 ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+    std::cout << "shm_ring is not available (no C++11, or no POSIX)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 05-shm-ring-latency.exe 05-shm-ring-latency.cpp && ./05-shm-ring-latency.exe
@@ -0,0 +1,150 @@
+// example/06-ring-io-engine.cpp
+// Feed many byte rings from pipes and tmpfs files; compare io_uring and poll() backends.
+
+#include "nonstd/ring_io_engine.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_RING_IO_ENGINE
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+typedef nonstd::ring_span<char>            byte_ring;
+typedef nonstd::ring_io_engine<byte_ring>  engine;
+
+struct sources
+{
+    std::vector<int> fds;
+    pid_t writer;
+};
+
+// pipes, written to by a child process in chunks:
+
+sources make_pipes( std::size_t count, std::size_t bytes )
+{
+    sources result = { std::vector<int>(), -1 };
+    std::vector<int> writers;
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        int fds[2];
+        if ( ::pipe( fds ) != 0 ) { std::perror( "pipe" ); std::exit( 1 ); }
+        result.fds.push_back( fds[0] );
+        writers.push_back( fds[1] );
+    }
+
+    result.writer = ::fork();
+
+    if ( result.writer == 0 )
+    {
+        std::vector<char> chunk( 4096, 'x' );
+
+        for ( std::size_t done = 0; done < bytes; done += chunk.size() )
+            for ( std::size_t i = 0; i < count; ++i )
+                if ( ::write( writers[i], &chunk[0], chunk.size() ) < 0 ) ::_exit( 1 );
+
+        ::_exit( 0 );
+    }
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        ::close( writers[i] );
+    }
+    return result;
+}
+
+// files on tmpfs (/dev/shm), unlinked after creation:
+
+sources make_files( std::size_t count, std::size_t bytes )
+{
+    sources result = { std::vector<int>(), -1 };
+    std::vector<char> content( bytes, 'y' );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        std::string const path = "/dev/shm/nsrs-engine-" + std::to_string( ::getpid() ) + "-" + std::to_string( i );
+        int const fd = ::open( path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600 );
+
+        if ( fd < 0 || ::write( fd, &content[0], bytes ) != static_cast<ssize_t>( bytes ) ) { std::perror( "tmpfs" ); std::exit( 1 ); }
+
+        ::unlink( path.c_str() );
+        ::lseek( fd, 0, SEEK_SET );
+        result.fds.push_back( fd );
+    }
+    return result;
+}
+
+void run( char const * what, sources src, std::size_t ring_size, bool force_poll )
+{
+    std::size_t const count = src.fds.size();
+
+    std::vector<char> storage( count * ring_size );
+    std::vector<byte_ring> rings;
+    rings.reserve( count );
+
+    engine eng( 256, force_poll );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        rings.push_back( byte_ring( storage.begin() + static_cast<std::ptrdiff_t>( i * ring_size ), storage.begin() + static_cast<std::ptrdiff_t>( ( i + 1 ) * ring_size ) ) );
+        eng.add( src.fds[i], rings.back() );
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    std::size_t total = 0;
+
+    while ( eng.active() > 0 )
+    {
+        if ( eng.run_once() < 0 ) { std::cerr << "engine error\n"; break; }
+
+        // consume in place: the ring segments are the application's buffers:
+
+        for ( byte_ring & ring : rings )
+        {
+            total += ring.size();
+            ring.consume_front( ring.size() );
+        }
+    }
+
+    double const seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    double const mbps    = static_cast<double>( total ) / seconds / 1e6;
+
+    for ( int fd : src.fds )
+        ::close( fd );
+    if ( src.writer > 0 )
+        ::waitpid( src.writer, nullptr, 0 );
+
+    std::cout << what << ( force_poll || eng.backend() == engine::backend_poll ? " poll    : " : " io_uring: " )
+              << count << " sources, " << static_cast<double>( total ) / 1e6 << " MB, " << mbps << " MB/s\n";
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const count = argc > 1 ? std::stoul( argv[1] ) : 64;
+    std::size_t const bytes = argc > 2 ? std::stoul( argv[2] ) : 1 << 20;
+    std::size_t const ring  = 64 * 1024;
+
+    for ( bool force_poll : { false, true } )
+    {
+        run( "pipes", make_pipes( count, bytes ), ring, force_poll );
+        run( "tmpfs", make_files( count, bytes ), ring, force_poll );
+    }
+}
+
+#else
+
+int main()
+{
+    std::cout << "ring_io_engine is not available (no C++11, or no POSIX)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 06-ring-io-engine.exe 06-ring-io-engine.cpp && ./06-ring-io-engine.exe
@@ -0,0 +1,51 @@
+// example/07-ring-logging-stream.cpp
+// Fixed-size logging stream that formats straight into a ring of characters.
+
+#include "nonstd/ring_streambuf.hpp"
+#include <iostream>
+#include <string>
+
+#if nsrs_HAVE_RING_STREAMBUF
+
+using nonstd::ring_span;
+using nonstd::ring_streambuf;
+
+int main()
+{
+    char storage[256];
+    ring_span<char> ring( storage, storage + sizeof(storage) );
+
+    ring_streambuf buf( ring );
+    std::ostream log( &buf );
+
+    for ( int i = 0; i < 20; ++i )
+    {
+        log << "tick " << i << ": price=" << 100.25 + i << '\n';
+
+        // ship what has been logged, e.g. via write_from( fd, ring ):
+
+        buf.pubsync();
+
+        if ( ring.size() > sizeof(storage) / 2 )
+        {
+            std::cout.write( ring.array_one().first, static_cast<std::streamsize>( ring.array_one().second ) );
+            std::cout.write( ring.array_two().first, static_cast<std::streamsize>( ring.array_two().second ) );
+            ring.consume_front( ring.size() );
+            buf.pubsync();
+        }
+    }
+
+    buf.pubsync();
+    std::cout << std::string( ring.begin(), ring.end() );
+}
+
+#else
+
+int main()
+{
+    std::cout << "ring_streambuf is not available (nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++98 -Wall -I../include -o 07-ring-logging-stream.exe 07-ring-logging-stream.cpp && ./07-ring-logging-stream.exe
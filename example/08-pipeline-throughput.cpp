@@ -0,0 +1,103 @@
+// example/08-pipeline-throughput.cpp
+// Throughput of a diamond of stages (decode -> enrich, validate -> publish) over one ring.
+
+#include "nonstd/pipeline_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_PIPELINE_RING
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct message
+{
+    long raw;
+    long decoded;
+    long enriched;
+    bool valid;
+};
+
+typedef nonstd::pipeline_ring<message> pipeline;
+
+template< class F >
+std::thread run_stage( pipeline & ring, pipeline::stage_type stage, long count, F f )
+{
+    return std::thread( [&ring, stage, count, f]()
+    {
+        for ( long done = 0; done < count; )
+        {
+            std::size_t const n = ring.process( stage, f );
+
+            if ( n == 0 )
+                std::this_thread::yield();
+
+            done += static_cast<long>( n );
+        }
+    } );
+}
+
+void run( std::size_t capacity, long count )
+{
+    std::vector<message> storage( capacity );
+    pipeline ring( storage.begin(), storage.end() );
+
+    pipeline::stage_type const decode   = ring.add_stage();
+    pipeline::stage_type const enrich   = ring.add_stage( { decode } );
+    pipeline::stage_type const validate = ring.add_stage( { decode } );
+    pipeline::stage_type const publish  = ring.add_stage( { enrich, validate } );
+
+    long checksum = 0;
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    threads.push_back( run_stage( ring, decode  , count, []( message & m ) { m.decoded  = m.raw ^ 0x5a5a; } ) );
+    threads.push_back( run_stage( ring, enrich  , count, []( message & m ) { m.enriched = m.decoded * 3; } ) );
+    threads.push_back( run_stage( ring, validate, count, []( message & m ) { m.valid    = m.decoded >= 0; } ) );
+    threads.push_back( run_stage( ring, publish , count, [&checksum]( message & m ) { if ( m.valid ) checksum += m.enriched; } ) );
+
+    for ( long i = 0; i < count; )
+    {
+        message * const slot = ring.try_claim();
+
+        if ( !slot )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        slot->raw = i++;
+        ring.publish();
+    }
+
+    for ( std::thread & t : threads )
+        t.join();
+
+    double const seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << "capacity " << capacity << ": " << static_cast<double>( count ) / seconds / 1e6 << " M messages/s"
+              << " (checksum " << checksum << ")\n";
+}
+
+int main( int argc, char * argv[] )
+{
+    long const count = argc > 1 ? std::stol( argv[1] ) : 2000000;
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads, 5 threads in pipeline\n";
+
+    for ( std::size_t capacity : { 64u, 1024u, 16384u } )
+        run( capacity, count );
+}
+
+#else
+
+int main()
+{
+    std::cout << "pipeline_ring is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 08-pipeline-throughput.exe 08-pipeline-throughput.cpp && ./08-pipeline-throughput.exe
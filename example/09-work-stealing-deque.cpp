@@ -0,0 +1,164 @@
+// example/09-work-stealing-deque.cpp
+// Fork-join task tree on per-worker deques: Chase-Lev work_stealing_deque versus mutex-protected ring<>.
+
+#include "nonstd/work_stealing_deque.hpp"
+#include "nonstd/ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_WORK_STEALING_DEQUE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct task
+{
+    int depth;
+};
+
+// lock-free: owner pushes and pops at the bottom, thieves steal from the top:
+
+struct lock_free_queue
+{
+    explicit lock_free_queue( std::size_t capacity )
+        : storage( capacity ), deque( storage.begin(), storage.end() ) {}
+
+    bool push ( task const & t ) { return deque.push( t ); }
+    bool pop  ( task & t )       { return deque.pop( t ); }
+    bool steal( task & t )       { return deque.steal( t ); }
+
+    std::vector<task> storage;
+    nonstd::work_stealing_deque<task> deque;
+};
+
+// locked: owner pushes and pops at the back, thieves take from the front:
+
+struct locked_queue
+{
+    explicit locked_queue( std::size_t capacity )
+        : ring( capacity ) {}
+
+    bool push( task const & t )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if ( ring.full() ) return false;
+        ring.push_back( t );
+        return true;
+    }
+
+    bool pop( task & t )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if ( ring.empty() ) return false;
+        t = ring.pop_back();
+        return true;
+    }
+
+    bool steal( task & t )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if ( ring.empty() ) return false;
+        t = ring.pop_front();
+        return true;
+    }
+
+    std::mutex mutex;
+    nonstd::ring< std::vector<task> > ring;
+};
+
+// fork: push one child and run the other; join is implicit in counting the leaves:
+
+template< class Queue >
+void execute( Queue & own, task t, std::atomic<long> & leaves )
+{
+    while ( t.depth > 0 )
+    {
+        task const child = { t.depth - 1 };
+
+        if ( !own.push( child ) )
+            execute( own, child, leaves );
+
+        t = child;
+    }
+
+    volatile long work = 0;
+    for ( int i = 0; i < 50; ++i )
+        work = work + i;
+
+    leaves.fetch_add( 1, std::memory_order_relaxed );
+}
+
+template< class Queue >
+double run( unsigned workers, int depth )
+{
+    std::vector< std::unique_ptr<Queue> > queues;
+    for ( unsigned i = 0; i < workers; ++i )
+        queues.push_back( std::unique_ptr<Queue>( new Queue( 1024 ) ) );
+
+    long const total = 1L << depth;
+    std::atomic<long> leaves( 0 );
+
+    auto const start = std::chrono::steady_clock::now();
+
+    task const root = { depth };
+    queues[0]->push( root );
+
+    std::vector<std::thread> threads;
+    for ( unsigned id = 0; id < workers; ++id )
+    {
+        threads.push_back( std::thread( [&, id]()
+        {
+            unsigned victim = id;
+            task t;
+
+            while ( leaves.load( std::memory_order_relaxed ) < total )
+            {
+                if ( queues[id]->pop( t ) )
+                {
+                    execute( *queues[id], t, leaves );
+                    continue;
+                }
+
+                victim = ( victim + 1 ) % workers;
+
+                if ( victim != id && queues[victim]->steal( t ) )
+                    execute( *queues[id], t, leaves );
+                else
+                    std::this_thread::yield();
+            }
+        } ) );
+    }
+
+    for ( std::thread & t : threads )
+        t.join();
+
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    unsigned const workers = argc > 1 ? static_cast<unsigned>( std::stoul( argv[1] ) ) : std::max( 1u, std::thread::hardware_concurrency() );
+    int      const depth   = argc > 2 ? std::stoi( argv[2] ) : 20;
+
+    double const leaves = static_cast<double>( 1L << depth );
+
+    std::cout << workers << " workers, " << leaves << " leaf tasks\n";
+    std::cout << "work_stealing_deque: " << leaves / run<lock_free_queue>( workers, depth ) / 1e6 << " M tasks/s\n";
+    std::cout << "mutex + ring<>     : " << leaves / run<locked_queue   >( workers, depth ) / 1e6 << " M tasks/s\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "work_stealing_deque is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 09-work-stealing-deque.exe 09-work-stealing-deque.cpp && ./09-work-stealing-deque.exe
@@ -0,0 +1,144 @@
+// example/10-work-stealing-pool.cpp
+// Scaling of work_stealing_pool from 1 to 64 workers: fork-join and embarrassingly parallel workloads.
+
+#include "nonstd/work_stealing_pool.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_WORK_STEALING_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using nonstd::pool_task;
+using nonstd::work_stealing_pool;
+
+// fork-join: recursive Fibonacci, spawning one half and computing the other:
+
+struct fib_job
+{
+    work_stealing_pool * pool;
+    int n;
+    long result;
+    std::atomic<bool> done;
+};
+
+long fib_serial( int n )
+{
+    return n < 2 ? n : fib_serial( n - 1 ) + fib_serial( n - 2 );
+}
+
+void fib_task( void * arg );
+
+void fib( fib_job & job )
+{
+    if ( job.n < 20 )
+    {
+        job.result = fib_serial( job.n );
+        return;
+    }
+
+    fib_job a; a.pool = job.pool; a.n = job.n - 1; a.done = false;
+    fib_job b; b.pool = job.pool; b.n = job.n - 2; b.done = false;
+
+    pool_task const task = { fib_task, &a };
+    job.pool->submit( task );
+    fib( b );
+    job.pool->help_until( [&a]() { return a.done.load( std::memory_order_acquire ); } );
+
+    job.result = a.result + b.result;
+}
+
+void fib_task( void * arg )
+{
+    fib_job & job = *static_cast<fib_job *>( arg );
+    fib( job );
+    job.done.store( true, std::memory_order_release );
+}
+
+double fork_join( work_stealing_pool & pool, int n )
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    fib_job job; job.pool = &pool; job.n = n; job.done = false;
+    pool_task const task = { fib_task, &job };
+
+    pool.submit( task );
+    pool.wait_idle();
+
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+// embarrassingly parallel: independent tasks, submitted in batches:
+
+void square_root_task( void * arg )
+{
+    double & x = *static_cast<double *>( arg );
+    for ( int i = 0; i < 200; ++i )
+        x = 0.5 * ( x + 2.0 / x );
+}
+
+double parallel_for( work_stealing_pool & pool, std::size_t count )
+{
+    std::vector<double> values( count, 1.0 );
+    std::vector<pool_task> tasks( count );
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        tasks[i].function = square_root_task;
+        tasks[i].argument = &values[i];
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for ( std::size_t i = 0; i < count; i += 1024 )
+        pool.submit( &tasks[i], &tasks[0] + std::min( count, i + 1024 ) );
+
+    pool.wait_idle();
+
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const max_workers = argc > 1 ? std::stoul( argv[1] ) : 64;
+    int         const n           = argc > 2 ? std::stoi( argv[2] ) : 32;
+    std::size_t const count       = argc > 3 ? std::stoul( argv[3] ) : 200000;
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads; fib(" << n << "), " << count << " independent tasks\n\n"
+              << "workers  fork-join [s]  speedup  parallel [s]  speedup\n";
+
+    double fj_base = 0, pf_base = 0;
+
+    for ( std::size_t workers = 1; workers <= max_workers; workers *= 2 )
+    {
+        work_stealing_pool pool( workers );
+
+        double const fj = fork_join   ( pool, n );
+        double const pf = parallel_for( pool, count );
+
+        if ( workers == 1 )
+        {
+            fj_base = fj;
+            pf_base = pf;
+        }
+
+        std::cout << std::setw( 7) << workers
+                  << std::setw(15) << fj << std::setw( 9) << fj_base / fj
+                  << std::setw(14) << pf << std::setw( 9) << pf_base / pf << "\n";
+    }
+}
+
+#else
+
+int main()
+{
+    std::cout << "work_stealing_pool is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 10-work-stealing-pool.exe 10-work-stealing-pool.cpp && ./10-work-stealing-pool.exe
@@ -0,0 +1,88 @@
+// example/11-soa-ring-scan.cpp
+// Scan one field of a tick history: ring_span of structs versus soa_ring column segments.
+
+#include "nonstd/soa_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_SOA_RING
+
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct tick
+{
+    std::int64_t  ts;
+    double        price;
+    std::int32_t  qty;
+    std::uint32_t flags;
+};
+
+template< class F >
+double measure( int repeat, F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    for ( int i = 0; i < repeat; ++i )
+        f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() / repeat;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const capacity = argc > 1 ? std::stoul( argv[1] ) : 1 << 22;
+    int         const repeat   = 20;
+
+    // array of structs:
+
+    std::vector<tick> aos( capacity );
+    nonstd::ring_span<tick> ticks( aos.begin(), aos.end() );
+
+    // struct of arrays:
+
+    std::vector<std::int64_t> ts( capacity ); std::vector<double> price( capacity );
+    std::vector<std::int32_t> qty( capacity ); std::vector<std::uint32_t> flags( capacity );
+    nonstd::soa_ring<std::int64_t, double, std::int32_t, std::uint32_t> columns( capacity, ts.data(), price.data(), qty.data(), flags.data() );
+
+    for ( std::size_t i = 0; i < capacity + capacity / 3; ++i )
+    {
+        tick const t = { static_cast<std::int64_t>( i ), 100.0 + static_cast<double>( i % 100 ), 1, 0 };
+        ticks.push_back( t );
+        columns.push_back( t.ts, t.price, t.qty, t.flags );
+    }
+
+    double sum_aos = 0, sum_soa = 0;
+
+    double const t_aos = measure( repeat, [&]()
+    {
+        sum_aos = 0;
+        for ( tick const & t : ticks )
+            sum_aos += t.price;
+    } );
+
+    // contiguous segments of one column vectorize:
+
+    double const t_soa = measure( repeat, [&]()
+    {
+        auto const one = columns.array_one<1>();
+        auto const two = columns.array_two<1>();
+        sum_soa = std::accumulate( one.first, one.first + one.second, 0.0 );
+        sum_soa = std::accumulate( two.first, two.first + two.second, sum_soa );
+    } );
+
+    std::cout << capacity << " ticks, sum of prices\n"
+              << "ring_span<tick>: " << t_aos * 1e3 << " ms (" << sum_aos << ")\n"
+              << "soa_ring column: " << t_soa * 1e3 << " ms (" << sum_soa << ")\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "soa_ring is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O3 -march=native -Wall -I../include -o 11-soa-ring-scan.exe 11-soa-ring-scan.cpp && ./11-soa-ring-scan.exe
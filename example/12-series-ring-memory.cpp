@@ -0,0 +1,88 @@
+// example/12-series-ring-memory.cpp
+// 24 hours of 10-second samples per metric: series_ring versus a ring of (timestamp, value) pairs.
+
+#include "nonstd/series_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_SERIES_RING
+
+#include "nonstd/ring.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef std::pair<std::int64_t, double> sample;
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const metrics   = argc > 1 ? std::stoul( argv[1] ) : 100;
+    std::size_t const retention = 24 * 60 * 60 / 10;
+    std::size_t const block     = 120;
+
+    // one extra block, so that retention is kept while the newest block fills:
+
+    std::vector< std::unique_ptr<nonstd::series_ring> > compressed;
+    std::vector< nonstd::ring< std::vector<sample> > >  plain;
+
+    for ( std::size_t m = 0; m < metrics; ++m )
+    {
+        compressed.push_back( std::unique_ptr<nonstd::series_ring>( new nonstd::series_ring( retention / block + 1, block ) ) );
+        plain.push_back( nonstd::ring< std::vector<sample> >( retention ) );
+    }
+
+    // two days of samples: gauges with a few decimals, counters, and constants:
+
+    std::int64_t const start = 1700000000;
+
+    for ( std::size_t i = 0; i < 2 * retention; ++i )
+    {
+        std::int64_t const ts = start + 10 * static_cast<std::int64_t>( i ) + ( i % 97 == 0 ? 1 : 0 );
+
+        for ( std::size_t m = 0; m < metrics; ++m )
+        {
+            double const value =
+                m % 3 == 0 ? std::floor( 1000 * ( 50 + 10 * std::sin( static_cast<double>( i ) / 500 ) ) ) / 1000
+              : m % 3 == 1 ? static_cast<double>( i * m )
+              :              42.0;
+
+            compressed[m]->push_back( ts, value );
+            plain[m].push_back( sample( ts, value ) );
+        }
+    }
+
+    std::size_t bytes = 0, samples = 0;
+    for ( std::size_t m = 0; m < metrics; ++m )
+    {
+        bytes   += compressed[m]->compressed_bytes();
+        samples += compressed[m]->size();
+    }
+
+    // decode everything once:
+
+    auto const t0 = std::chrono::steady_clock::now();
+    double sum = 0;
+    for ( std::size_t m = 0; m < metrics; ++m )
+        for ( nonstd::series_ring::const_iterator pos = compressed[m]->begin(); pos != compressed[m]->end(); ++pos )
+            sum += pos->second;
+    double const seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+
+    std::cout << metrics << " metrics, " << retention << " samples retained per metric\n"
+              << "ring<pair>  : " << static_cast<double>( metrics * retention * sizeof(sample) ) / 1e6 << " MB\n"
+              << "series_ring : " << static_cast<double>( bytes ) / 1e6 << " MB for " << samples << " samples, "
+              << static_cast<double>( bytes ) * 8 / static_cast<double>( samples ) << " bits/sample\n"
+              << "decoding    : " << static_cast<double>( samples ) / seconds / 1e6 << " M samples/s (" << sum << ")\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "series_ring is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 12-series-ring-memory.exe 12-series-ring-memory.cpp && ./12-series-ring-memory.exe
@@ -0,0 +1,156 @@
+// example/13-bip-buffer.cpp
+// Variable-size frames whose size is known only after writing: bip_buffer in place versus copying through ring_span<char>.
+
+#include "nonstd/bip_buffer.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_BIP_BUFFER && nsrs_RING_SPAN_LITE_EXTENSION
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::size_t const max_frame = 4096;
+
+// "decoder": writes a frame of up to max_frame bytes and reports its size:
+
+std::size_t decode( char * out, unsigned seq )
+{
+    std::size_t const n = 64 + ( seq * 2654435761u ) % ( max_frame - 64 );
+    std::memset( out, static_cast<int>( seq & 0x7f ), n );
+    return n;
+}
+
+// consumer: needs each frame contiguous:
+
+unsigned long consume( char const * frame, std::size_t n )
+{
+    return static_cast<unsigned char>( frame[0] ) + static_cast<unsigned char>( frame[n - 1] ) + n;
+}
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    unsigned    const frames   = argc > 1 ? static_cast<unsigned>( std::stoul( argv[1] ) ) : 200000;
+    std::size_t const capacity = 256 * 1024;
+
+    std::vector<char> storage( capacity );
+    unsigned long sum_bip = 0, sum_copy = 0, sum_spsc = 0;
+    double bytes = 0;
+
+    // bip_buffer: decode in place, consume in place:
+
+    double const t_bip = measure( [&]()
+    {
+        nonstd::bip_buffer<char> bip( storage.begin(), storage.end() );
+
+        for ( unsigned seq = 0; seq < frames; ++seq )
+        {
+            char * const p = bip.reserve( max_frame );
+            std::size_t const n = decode( p, seq );
+            bip.commit( n );
+            bytes += static_cast<double>( n );
+
+            std::pair<char *, std::size_t> const block = bip.read();
+            sum_bip += consume( block.first, block.second );
+            bip.release( block.second );
+        }
+    } );
+
+    // ring_span<char>: decode into a scratch buffer, copy in, copy out to make it contiguous:
+
+    double const t_copy = measure( [&]()
+    {
+        nonstd::ring_span<char> ring( storage.begin(), storage.end() );
+        std::vector<char> scratch( max_frame ), frame( max_frame );
+
+        for ( unsigned seq = 0; seq < frames; ++seq )
+        {
+            std::size_t const n = decode( &scratch[0], seq );
+
+            std::pair<char *, std::size_t> one = ring.free_array_one();
+            std::size_t const n1 = std::min( n, one.second );
+            std::memcpy( one.first, &scratch[0], n1 );
+            ring.commit_back( n1 );
+            std::memcpy( ring.free_array_one().first, &scratch[n1], n - n1 );
+            ring.commit_back( n - n1 );
+
+            one = ring.array_one();
+            std::size_t const m1 = std::min( n, one.second );
+            std::memcpy( &frame[0], one.first, m1 );
+            ring.consume_front( m1 );
+            std::memcpy( &frame[m1], ring.array_one().first, n - m1 );
+            ring.consume_front( n - m1 );
+
+            sum_copy += consume( &frame[0], n );
+        }
+    } );
+
+    // bip_buffer across a producer and a consumer thread:
+
+    double const t_spsc = measure( [&]()
+    {
+        nonstd::bip_buffer<char> bip( storage.begin(), storage.end() );
+
+        std::thread consumer( [&]()
+        {
+            for ( unsigned seq = 0; seq < frames; )
+            {
+                std::pair<char *, std::size_t> const block = bip.read();
+
+                if ( block.second == 0 )
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // frames are committed whole: walk them by their decoded length:
+
+                std::size_t done = 0;
+                while ( done < block.second )
+                {
+                    std::size_t const n = 64 + ( seq++ * 2654435761u ) % ( max_frame - 64 );
+                    sum_spsc += consume( block.first + done, n );
+                    done += n;
+                }
+                bip.release( done );
+            }
+        } );
+
+        for ( unsigned seq = 0; seq < frames; ++seq )
+        {
+            char * p;
+            while ( ( p = bip.reserve( max_frame ) ) == nsrs_nullptr )
+                std::this_thread::yield();
+            bip.commit( decode( p, seq ) );
+        }
+
+        consumer.join();
+    } );
+
+    std::cout << frames << " frames, " << bytes / 1e6 << " MB\n"
+              << "bip_buffer, in place      : " << bytes / t_bip  / 1e9 << " GB/s (" << sum_bip  << ")\n"
+              << "ring_span<char>, copying  : " << bytes / t_copy / 1e9 << " GB/s (" << sum_copy << ")\n"
+              << "bip_buffer, two threads   : " << bytes / t_spsc / 1e9 << " GB/s (" << sum_spsc << ")\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "bip_buffer or ring_span segments are not available (no C++11, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 13-bip-buffer.exe 13-bip-buffer.cpp && ./13-bip-buffer.exe
@@ -0,0 +1,73 @@
+// example/14-string-ring-allocations.cpp
+// Keep the last log lines: heap allocations of ring_span<std::string> versus string_ring.
+
+#include "nonstd/string_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_STRING_RING
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+// count every allocation:
+
+static unsigned long allocations = 0;
+
+void * operator new( std::size_t n )
+{
+    ++allocations;
+    if ( void * p = std::malloc( n ? n : 1 ) )
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete( void * p ) noexcept
+{
+    std::free( p );
+}
+
+void operator delete( void * p, std::size_t ) noexcept
+{
+    std::free( p );
+}
+
+int main()
+{
+    std::size_t const window = 1000;
+    int         const lines  = 100000;
+
+    std::vector<std::string> line( 16 );
+    for ( std::size_t i = 0; i < line.size(); ++i )
+        line[i] = "2026-10-19T12:00:00Z worker-" + std::to_string( i ) + ( i % 2 ? " ok" : " request took longer than expected, retrying with backoff" );
+
+    std::vector<std::string> storage( window );
+    nonstd::ring_span<std::string> strings( storage.begin(), storage.end() );
+    nonstd::string_ring ring( window, 64 * 1024 );
+
+    unsigned long const before_strings = allocations;
+    for ( int i = 0; i < lines; ++i )
+        strings.push_back( line[ static_cast<std::size_t>( i ) % line.size() ] );
+    unsigned long const after_strings = allocations;
+
+    for ( int i = 0; i < lines; ++i )
+        ring.push_back( line[ static_cast<std::size_t>( i ) % line.size() ] );
+    unsigned long const after_ring = allocations;
+
+    std::cout << lines << " log lines, window of " << window << "\n"
+              << "ring_span<std::string>: " << after_strings - before_strings << " allocations\n"
+              << "string_ring           : " << after_ring - after_strings << " allocations, " << ring.size() << " lines kept\n"
+              << "newest: " << ring.back() << "\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "string_ring is not available (no C++17, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++17 -O2 -Wall -I../include -o 14-string-ring-allocations.exe 14-string-ring-allocations.cpp && ./14-string-ring-allocations.exe
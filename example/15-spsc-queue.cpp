@@ -0,0 +1,91 @@
+// example/15-spsc-queue.cpp
+// Unbounded spsc_queue versus a bounded single-reader broadcast_ring, and the segments a burst leaves behind.
+
+#include "nonstd/spsc_queue.hpp"
+#include "nonstd/broadcast_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_SPSC_QUEUE && nsrs_HAVE_BROADCAST_RING
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    long const count = argc > 1 ? std::stol( argv[1] ) : 10000000;
+
+    long sum_ring = 0, sum_queue = 0;
+
+    // bounded: the producer waits when the ring is full:
+
+    double const t_ring = measure( [&]()
+    {
+        std::vector<long> storage( 1024 );
+        nonstd::broadcast_ring<long> ring( storage.begin(), storage.end(), 1 );
+
+        std::thread consumer( [&]()
+        {
+            long value;
+            for ( long i = 0; i < count; )
+            {
+                if ( ! ring.try_pop( 0, value ) ) { std::this_thread::yield(); continue; }
+                sum_ring += value; ++i;
+            }
+        } );
+
+        for ( long i = 0; i < count; ++i )
+            ring.push( i );
+
+        consumer.join();
+    } );
+
+    // unbounded: the producer never waits; drained segments are reused:
+
+    std::size_t segments = 0;
+
+    double const t_queue = measure( [&]()
+    {
+        nonstd::spsc_queue<long> queue;
+
+        std::thread consumer( [&]()
+        {
+            long value;
+            for ( long i = 0; i < count; )
+            {
+                if ( ! queue.try_pop( value ) ) { std::this_thread::yield(); continue; }
+                sum_queue += value; ++i;
+            }
+        } );
+
+        for ( long i = 0; i < count; ++i )
+            queue.push( i );
+
+        consumer.join();
+        segments = queue.segments();
+    } );
+
+    std::cout << count << " elements, one producer, one consumer\n"
+              << "broadcast_ring, bounded: " << static_cast<double>( count ) / t_ring  / 1e6 << " M/s (" << sum_ring  << ")\n"
+              << "spsc_queue, unbounded  : " << static_cast<double>( count ) / t_queue / 1e6 << " M/s (" << sum_queue << "), " << segments << " segments allocated\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "spsc_queue is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 15-spsc-queue.exe 15-spsc-queue.cpp && ./15-spsc-queue.exe
@@ -0,0 +1,84 @@
+// example/16-ring-migrate.cpp
+// Resize a ring of 10M elements: re-push every element into a new ring_span versus migrate_to().
+
+#include "nonstd/ring_span.hpp"
+#include <iostream>
+
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+// a full, wrapped ring of n elements in storage:
+
+nonstd::ring_span<long> make_ring( std::vector<long> & storage )
+{
+    nonstd::ring_span<long> ring( storage.begin(), storage.end() );
+
+    for ( std::size_t i = 0; i < storage.size() + storage.size() / 3; ++i )
+        ring.push_back( static_cast<long>( i ) );
+
+    return ring;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const count = argc > 1 ? std::stoul( argv[1] ) : 10000000;
+
+    std::vector<long> storage( count ), grown( count + count / 2 );
+    long front_push = 0, front_migrate = 0;
+
+    // re-push: one push_back, with its index arithmetic, per element:
+
+    double t_push = 0;
+    {
+        nonstd::ring_span<long> ring = make_ring( storage );
+        nonstd::ring_span<long> bigger( grown.begin(), grown.end() );
+
+        t_push = measure( [&]()
+        {
+            for ( long value : ring )
+                bigger.push_back( value );
+        } );
+
+        front_push = bigger.front();
+    }
+
+    // migrate_to(): two bulk moves, one per contiguous segment:
+
+    double t_migrate = 0;
+    {
+        nonstd::ring_span<long> ring = make_ring( storage );
+
+        t_migrate = measure( [&]()
+        {
+            ring.migrate_to( grown.begin(), grown.end() );
+        } );
+
+        front_migrate = ring.front();
+    }
+
+    std::cout << count << " elements, grown to " << grown.size() << "\n"
+              << "re-push    : " << t_push    * 1e3 << " ms (front " << front_push    << ")\n"
+              << "migrate_to : " << t_migrate * 1e3 << " ms (front " << front_migrate << ")\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "migrate_to() is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 16-ring-migrate.exe 16-ring-migrate.cpp && ./16-ring-migrate.exe
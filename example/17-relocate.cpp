@@ -0,0 +1,76 @@
+// example/17-relocate.cpp
+// Rings of std::unique_ptr: linearize and migrate bytewise (trivially relocatable) versus element by element.
+
+#include "nonstd/ring_span.hpp"
+#include <iostream>
+
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct Widget{ int value; };
+
+// same layout as std::unique_ptr<Widget>, but not declared trivially relocatable:
+
+struct Boxed
+{
+    std::unique_ptr<Widget> p;
+};
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+std::unique_ptr<Widget> & ptr( std::unique_ptr<Widget> & p ) { return p; }
+std::unique_ptr<Widget> & ptr( Boxed & b ) { return b.p; }
+
+// fill a wrapped ring, then linearize it and migrate it to a larger buffer:
+
+template< class T >
+void run( char const * name, std::size_t count )
+{
+    std::vector<T> storage( count ), grown( 2 * count );
+    nonstd::ring_span<T> ring( storage.begin(), storage.end() );
+
+    for ( std::size_t i = 0; i < count + count / 3; ++i )
+    {
+        T t; ptr( t ).reset( new Widget{ static_cast<int>( i ) } );
+        ring.push_back( std::move( t ) );
+    }
+
+    double const t_linearize = measure( [&]() { ring.linearize(); } );
+    double const t_migrate   = measure( [&]() { ring.migrate_to( grown.begin(), grown.end() ); } );
+
+    std::cout << name
+        << ": linearize " << t_linearize * 1e3 << " ms"
+        << ", migrate_to " << t_migrate * 1e3 << " ms"
+        << " (front " << ptr( ring.front() )->value << ")\n";
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const count = argc > 1 ? std::stoul( argv[1] ) : 4000000;
+
+    std::cout << count << " elements\n";
+
+    run< std::unique_ptr<Widget> >( "unique_ptr, bytewise    ", count );
+    run< Boxed                   >( "Boxed, element by element", count );
+}
+
+#else
+
+int main()
+{
+    std::cout << "linearize() and migrate_to() are not available (no C++11, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 17-relocate.exe 17-relocate.cpp && ./17-relocate.exe
@@ -0,0 +1,61 @@
+// example/18-large-ring.cpp
+// std::lower_bound on a ring_span of more than 4G elements on sparse memory, versus one of 1M elements.
+
+#include "nonstd/ring_span.hpp"
+#include <iostream>
+
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION && defined( __linux__ ) && defined( __LP64__ )
+
+#include <algorithm>
+#include <chrono>
+#include <sys/mman.h>
+
+typedef nonstd::ring_span<unsigned char>::iterator::difference_type difference_type;
+
+// ring of n bytes wrapped at 3/5 of the buffer: zeros followed by 1000 ones;
+// returns the mean time of a lower_bound() for the first one, in ns:
+
+double lookup( std::size_t n, int repeat )
+{
+    void * const map = ::mmap( nullptr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+
+    if ( map == MAP_FAILED )
+        return -1;
+
+    unsigned char * const data = static_cast<unsigned char *>( map );
+    nonstd::ring_span<unsigned char> ring( data, data + n, data + n / 5 * 3, n );
+
+    for ( std::size_t i = n - 1000; i < n; ++i )
+        ring[i] = 1;
+
+    difference_type sum = 0;
+    auto const start = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < repeat; ++i )
+        sum += std::lower_bound( ring.begin(), ring.end(), static_cast<unsigned char>( 1 + i % 2 ) ) - ring.begin();
+
+    double const ns = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count() / repeat;
+
+    ::munmap( map, n );
+    return sum > 0 ? ns : -1;
+}
+
+int main()
+{
+    std::size_t const small = std::size_t( 1 ) << 20;
+    std::size_t const large = ( std::size_t( 5 ) << 30 ) + 3;
+
+    std::cout << "lower_bound, " << small << " elements: " << lookup( small, 1000000 ) << " ns\n"
+              << "lower_bound, " << large << " elements: " << lookup( large, 1000000 ) << " ns\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "large rings need C++11, 64-bit Linux and nsrs_CONFIG_STRICT_P0059=0\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 18-large-ring.exe 18-large-ring.cpp && ./18-large-ring.exe
@@ -0,0 +1,82 @@
+// example/19-ring-pool.cpp
+// One million session histories: ring_pool versus a ring<std::vector> per session.
+
+#include "nonstd/ring_pool.hpp"
+#include "nonstd/ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_RING_POOL && nsrs_RING_SPAN_LITE_EXTENSION
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const sessions = argc > 1 ? std::stoul( argv[1] ) : 1000000;
+    std::size_t const history  = 8;
+    std::size_t const events   = 4 * sessions;
+
+    long sum_pool = 0, sum_rings = 0;
+
+    // ring_pool: one slab, headers column-wise:
+
+    double const t_pool = measure( [&]()
+    {
+        nonstd::ring_pool<long> pool( sessions * history, sessions );
+
+        typedef nonstd::ring_pool<long>::handle_type handle_type;
+        std::vector<handle_type> handles;
+        handles.reserve( sessions );
+
+        for ( std::size_t s = 0; s < sessions; ++s )
+            handles.push_back( pool.create( history ) );
+
+        for ( std::size_t e = 0; e < events; ++e )
+            pool.push_back( handles[ e * 7919 % sessions ], static_cast<long>( e ) );
+
+        pool.for_each( [&]( handle_type h ) { if ( ! pool.empty( h ) ) sum_pool += pool.back( h ); } );
+    } );
+
+    // a ring<std::vector> per session: an allocation each, headers spread over the heap:
+
+    double const t_rings = measure( [&]()
+    {
+        typedef nonstd::ring< std::vector<long>, true > ring_type;
+        std::vector< std::unique_ptr<ring_type> > rings;
+        rings.reserve( sessions );
+
+        for ( std::size_t s = 0; s < sessions; ++s )
+            rings.emplace_back( new ring_type( history ) );
+
+        for ( std::size_t e = 0; e < events; ++e )
+            rings[ e * 7919 % sessions ]->push_back( static_cast<long>( e ) );
+
+        for ( auto const & ring : rings )
+            if ( ! ring->empty() ) sum_rings += ring->back();
+    } );
+
+    std::cout << sessions << " sessions, " << events << " events, history of " << history << "\n"
+              << "ring_pool      : " << t_pool  * 1e3 << " ms (" << sum_pool  << ")\n"
+              << "ring<vector> * : " << t_rings * 1e3 << " ms (" << sum_rings << ")\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "ring_pool is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 19-ring-pool.exe 19-ring-pool.cpp && ./19-ring-pool.exe
@@ -0,0 +1,129 @@
+// example/20-ring-map.cpp
+// Last 8 prices per instrument with LRU eviction: ring_map versus std::unordered_map, std::deque and std::list.
+
+#include "nonstd/ring_map.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_RING_MAP
+
+#include <chrono>
+#include <deque>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const keys     = argc > 1 ? std::stoul( argv[1] ) : 100000;
+    std::size_t const history  = 8;
+    std::size_t const budget   = keys * history / 2;
+    std::size_t const universe = 2 * keys;
+    std::size_t const events   = 50 * keys;
+
+    std::vector< std::pair<long, long> > ticks;
+    ticks.reserve( events );
+
+    for ( std::size_t e = 0; e < events; ++e )
+        ticks.push_back( std::make_pair( static_cast<long>( e * e % universe ), static_cast<long>( e ) ) );
+
+    std::size_t kept_map = 0, kept_batch = 0, kept_std = 0;
+
+    // ring_map, one upsert at a time and in batches:
+
+    double const t_map = measure( [&]()
+    {
+        nonstd::ring_map<long, long, history> map( keys, budget );
+
+        for ( auto const & tick : ticks )
+            map.push_back( tick.first, tick.second );
+
+        kept_map = map.elements();
+    } );
+
+    double const t_batch = measure( [&]()
+    {
+        nonstd::ring_map<long, long, history> map( keys, budget );
+
+        for ( std::size_t e = 0; e < events; e += 256 )
+            map.push_back( ticks.begin() + static_cast<long>( e ), ticks.begin() + static_cast<long>( std::min( e + 256, events ) ) );
+
+        kept_batch = map.elements();
+    } );
+
+    // node-based map, a deque per key and an LRU list of keys:
+
+    double const t_std = measure( [&]()
+    {
+        struct entry { std::deque<long> values; std::list<long>::iterator lru; };
+
+        std::unordered_map<long, entry> map;
+        std::list<long> lru;
+        std::size_t elements = 0;
+
+        auto evict = [&]()
+        {
+            auto const pos = map.find( lru.back() );
+            elements -= pos->second.values.size();
+            map.erase( pos );
+            lru.pop_back();
+        };
+
+        for ( auto const & tick : ticks )
+        {
+            auto pos = map.find( tick.first );
+
+            if ( pos == map.end() )
+            {
+                if ( map.size() == keys )
+                    evict();
+
+                lru.push_front( tick.first );
+                pos = map.emplace( tick.first, entry{ std::deque<long>(), lru.begin() } ).first;
+            }
+            else
+            {
+                lru.splice( lru.begin(), lru, pos->second.lru );
+            }
+
+            std::deque<long> & values = pos->second.values;
+
+            if ( values.size() == history )
+                values.pop_front();
+            else
+                ++elements;
+
+            values.push_back( tick.second );
+
+            while ( elements > budget )
+                evict();
+        }
+
+        kept_std = elements;
+    } );
+
+    std::cout << events << " ticks over " << universe << " instruments, " << keys << " keys, budget " << budget << "\n"
+              << "ring_map        : " << t_map   * 1e3 << " ms (" << kept_map   << " kept)\n"
+              << "ring_map, batch : " << t_batch * 1e3 << " ms (" << kept_batch << " kept)\n"
+              << "unordered_map   : " << t_std   * 1e3 << " ms (" << kept_std   << " kept)\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "ring_map is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -I../include -o 20-ring-map.exe 20-ring-map.cpp && ./20-ring-map.exe
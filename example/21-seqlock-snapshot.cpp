@@ -0,0 +1,101 @@
+// example/21-seqlock-snapshot.cpp
+// Hot writer with a monitor thread taking snapshots: seqlock_ring versus a mutex around ring_span.
+
+#include "nonstd/seqlock_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_SEQLOCK_RING
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const pushes   = argc > 1 ? std::stoul( argv[1] ) : 20000000;
+    std::size_t const capacity = 256;
+
+    std::vector<long> storage( capacity ), snap( capacity );
+    std::atomic<bool> done( false );
+    std::size_t snaps_seqlock = 0, snaps_mutex = 0;
+
+    // seqlock_ring: the writer never waits for the monitor:
+
+    nonstd::seqlock_ring<long> ring( storage.begin(), storage.end() );
+
+    std::thread monitor( [&]()
+    {
+        while ( !done.load() )
+        {
+            ring.snapshot( snap.data() );
+            ++snaps_seqlock;
+            std::this_thread::yield();
+        }
+    } );
+
+    double const t_seqlock = measure( [&]()
+    {
+        for ( std::size_t i = 0; i < pushes; ++i )
+            ring.push_back( static_cast<long>( i ) );
+    } );
+
+    done = true;
+    monitor.join();
+
+    // ring_span under a mutex: the writer waits while the monitor copies:
+
+    nonstd::ring_span<long> span( storage.begin(), storage.end() );
+    std::mutex mutex;
+    done = false;
+
+    monitor = std::thread( [&]()
+    {
+        while ( !done.load() )
+        {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                std::copy( span.begin(), span.end(), snap.begin() );
+            }
+            ++snaps_mutex;
+            std::this_thread::yield();
+        }
+    } );
+
+    double const t_mutex = measure( [&]()
+    {
+        for ( std::size_t i = 0; i < pushes; ++i )
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            span.push_back( static_cast<long>( i ) );
+        }
+    } );
+
+    done = true;
+    monitor.join();
+
+    std::cout << pushes << " pushes into a ring of " << capacity << ", one monitor thread\n"
+              << "seqlock_ring : " << static_cast<double>( pushes ) / t_seqlock * 1e-6 << " M pushes/s, " << snaps_seqlock << " snapshots\n"
+              << "mutex        : " << static_cast<double>( pushes ) / t_mutex   * 1e-6 << " M pushes/s, " << snaps_mutex   << " snapshots\n";
+}
+
+#else
+
+int main()
+{
+    std::cout << "seqlock_ring is not available (no C++11)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 21-seqlock-snapshot.exe 21-seqlock-snapshot.cpp && ./21-seqlock-snapshot.exe
@@ -0,0 +1,189 @@
+// example/22-combining-ring.cpp
+// Threads doing mixed push/pop on a shared ring: flat combining versus a mutex and a lock-free queue.
+
+#include "nonstd/combining_ring.hpp"
+#include <iostream>
+
+#if nsrs_HAVE_COMBINING_RING
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+template< class F >
+double measure( F f )
+{
+    auto const start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+typedef nonstd::ring< std::vector<long> > ring_type;
+
+// bounded lock-free multi-producer, multi-consumer queue with a sequence per cell:
+
+class mpmc_queue
+{
+public:
+    explicit mpmc_queue( std::size_t capacity )
+        : m_cells( new cell[ capacity ] ), m_mask( capacity - 1 ), m_head( 0 ), m_tail( 0 )
+    {
+        for ( std::size_t i = 0; i < capacity; ++i )
+            m_cells[i].seq.store( i, std::memory_order_relaxed );
+    }
+
+    bool try_push( long value )
+    {
+        std::size_t pos = m_tail.load( std::memory_order_relaxed );
+
+        for ( ;; )
+        {
+            cell & c = m_cells[ pos & m_mask ];
+            std::size_t const seq = c.seq.load( std::memory_order_acquire );
+
+            if ( seq == pos )
+            {
+                if ( m_tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                {
+                    c.value = value;
+                    c.seq.store( pos + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if ( seq < pos )
+                return false;
+            else
+                pos = m_tail.load( std::memory_order_relaxed );
+        }
+    }
+
+    bool try_pop( long & value )
+    {
+        std::size_t pos = m_head.load( std::memory_order_relaxed );
+
+        for ( ;; )
+        {
+            cell & c = m_cells[ pos & m_mask ];
+            std::size_t const seq = c.seq.load( std::memory_order_acquire );
+
+            if ( seq == pos + 1 )
+            {
+                if ( m_head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                {
+                    value = c.value;
+                    c.seq.store( pos + m_mask + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if ( seq < pos + 1 )
+                return false;
+            else
+                pos = m_head.load( std::memory_order_relaxed );
+        }
+    }
+
+private:
+    struct cell { std::atomic<std::size_t> seq; long value; };
+
+    std::unique_ptr<cell[]>     m_cells;
+    std::size_t                 m_mask;
+    char                        m_pad0[ 64 ];
+    std::atomic<std::size_t>    m_head;
+    char                        m_pad1[ 64 ];
+    std::atomic<std::size_t>    m_tail;
+    char                        m_pad2[ 64 ];
+};
+
+// each thread pushes a batch of values, then pops as many, ops times in total:
+
+template< class Push, class Pop >
+double run( std::size_t threads, std::size_t ops, std::size_t batch, Push push, Pop pop )
+{
+    return measure( [&]()
+    {
+        std::vector<std::thread> workers;
+
+        for ( std::size_t t = 0; t < threads; ++t )
+        {
+            workers.emplace_back( [=]()
+            {
+                std::vector<long> values( batch );
+
+                for ( std::size_t i = 0; i < ops / threads; i += 2 * batch )
+                {
+                    for ( std::size_t k = 0; k < batch; ++k )
+                        values[k] = static_cast<long>( i + k );
+
+                    push( t, values.data(), batch );
+                    pop ( t, values.data(), batch );
+                }
+            } );
+        }
+
+        for ( auto & worker : workers )
+            worker.join();
+    } );
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const threads  = argc > 1 ? std::stoul( argv[1] ) : 4;
+    std::size_t const ops      = argc > 2 ? std::stoul( argv[2] ) : 4000000;
+    std::size_t const capacity = 1024;
+
+    std::cout << threads << " threads, " << ops << " operations, ring of " << capacity << "\n";
+
+    for ( std::size_t batch : { std::size_t( 1 ), std::size_t( 8 ) } )
+    {
+        nonstd::combining_ring<ring_type> combining( capacity, threads );
+
+        double const t_combining = run( threads, ops, batch,
+            [&]( std::size_t t, long const * in, std::size_t n ) { combining.push_back( t, in, n ); },
+            [&]( std::size_t t, long * out, std::size_t n ) { combining.pop_front( t, out, n ); } );
+
+        ring_type ring( capacity );
+        std::mutex mutex;
+
+        double const t_mutex = run( threads, ops, batch,
+            [&]( std::size_t, long const * in, std::size_t n )
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                for ( std::size_t k = 0; k < n && !ring.full(); ++k )
+                    ring.push_back( in[k] );
+            },
+            [&]( std::size_t, long * out, std::size_t n )
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                for ( std::size_t k = 0; k < n && !ring.empty(); ++k )
+                    out[k] = ring.pop_front();
+            } );
+
+        mpmc_queue queue( capacity );
+
+        double const t_queue = run( threads, ops, batch,
+            [&]( std::size_t, long const * in, std::size_t n ) { for ( std::size_t k = 0; k < n && queue.try_push( in[k] ); ++k ) {} },
+            [&]( std::size_t, long * out, std::size_t n ) { for ( std::size_t k = 0; k < n && queue.try_pop( out[k] ); ++k ) {} } );
+
+        double const mops = static_cast<double>( ops ) * 1e-6;
+
+        std::cout << "batch of " << batch << ":\n"
+                  << "  combining_ring : " << mops / t_combining << " M ops/s\n"
+                  << "  mutex          : " << mops / t_mutex     << " M ops/s\n"
+                  << "  lock-free queue: " << mops / t_queue     << " M ops/s\n";
+    }
+}
+
+#else
+
+int main()
+{
+    std::cout << "combining_ring is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)\n";
+}
+
+#endif
+
+// g++ -std=c++11 -O2 -Wall -pthread -I../include -o 22-combining-ring.exe 22-combining-ring.cpp && ./22-combining-ring.exe
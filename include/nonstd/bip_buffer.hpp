@@ -0,0 +1,152 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_BIP_BUFFER_LITE_HPP
+#define NONSTD_BIP_BUFFER_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Lock-free single-producer, single-consumer bip buffer (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_BIP_BUFFER  1
+#else
+# define nsrs_HAVE_BIP_BUFFER  0
+#endif
+
+#if nsrs_HAVE_BIP_BUFFER
+
+#include <atomic>
+#include <utility>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// bip_buffer: contiguous variable-size chunks, one producer and one consumer thread.
+//
+// The producer reserves a contiguous block of up to the size it may need,
+// fills it, and commits the part it used. A reservation that does not fit
+// before the end of the buffer starts at the beginning, and the unused end is
+// skipped (the watermark). The consumer reads the next contiguous committed
+// block in place and releases what it consumed.
+//
+template< class T >
+class bip_buffer
+{
+public:
+    typedef T                                   value_type;
+    typedef std::size_t                         size_type;
+    typedef std::pair< T *, size_type >         block_type;
+
+    template< class ContiguousIterator >
+    bip_buffer( ContiguousIterator begin, ContiguousIterator end ) nsrs_noexcept
+        : m_data     ( &* begin )
+        , m_capacity ( static_cast<size_type>( end - begin ) )
+        , m_reserved ( 0 )
+        , m_write    ( 0 )
+        , m_last     ( 0 )
+        , m_read     ( 0 )
+    {}
+
+    bip_buffer( bip_buffer const & ) = delete;
+    bip_buffer & operator=( bip_buffer const & ) = delete;
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_capacity;
+    }
+
+    // producer side: contiguous block of n elements, nullptr if not available:
+
+    T * reserve( size_type n ) nsrs_noexcept
+    {
+        size_type const w = m_write.load( std::memory_order_relaxed );
+        size_type const r = m_read .load( std::memory_order_acquire );
+
+        if ( w >= r )
+        {
+            if ( m_capacity - w >= n )  m_reserved = w;
+            else if ( r > n )           m_reserved = 0;     // wrap; keep write != read
+            else                        return nsrs_nullptr;
+        }
+        else
+        {
+            if ( r - w > n )            m_reserved = w;
+            else                        return nsrs_nullptr;
+        }
+        return m_data + m_reserved;
+    }
+
+    // publish the first n elements of the last reservation:
+
+    void commit( size_type n ) nsrs_noexcept
+    {
+        if ( n == 0 )
+            return;
+
+        size_type const w = m_write.load( std::memory_order_relaxed );
+
+        if ( m_reserved < w )
+            m_last.store( w, std::memory_order_relaxed );
+
+        m_write.store( m_reserved + n, std::memory_order_release );
+    }
+
+    // consumer side: next contiguous block of committed elements, size 0 if none:
+
+    block_type read() nsrs_noexcept
+    {
+        size_type       r = m_read .load( std::memory_order_relaxed );
+        size_type const w = m_write.load( std::memory_order_acquire );
+
+        if ( w >= r )
+            return block_type( m_data + r, w - r );
+
+        // producer wrapped: read up to the watermark, then from the beginning:
+
+        size_type const last = m_last.load( std::memory_order_relaxed );
+
+        if ( r < last )
+            return block_type( m_data + r, last - r );
+
+        r = 0;
+        m_read.store( r, std::memory_order_release );
+
+        return block_type( m_data, w );
+    }
+
+    // consume the first n elements of the block read:
+
+    void release( size_type n ) nsrs_noexcept
+    {
+        m_read.store( m_read.load( std::memory_order_relaxed ) + n, std::memory_order_release );
+    }
+
+private:
+    T *                     m_data;
+    size_type               m_capacity;
+    size_type               m_reserved;     // producer only
+    char                    m_pad0[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<size_type>  m_write;        // written by producer
+    std::atomic<size_type>  m_last;         // written by producer
+    char                    m_pad1[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<size_type>  m_read;         // written by consumer
+    char                    m_pad2[ nsrs_CONFIG_CACHELINE_SIZE ];
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::bip_buffer;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_BIP_BUFFER
+
+#endif // NONSTD_BIP_BUFFER_LITE_HPP
@@ -0,0 +1,239 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_BIT_RING_LITE_HPP
+#define NONSTD_BIT_RING_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Ring of flags packed 64 per word (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_BIT_RING  1
+#else
+# define nsrs_HAVE_BIT_RING  0
+#endif
+
+#if nsrs_HAVE_BIT_RING
+
+#include <cstdint>
+
+namespace nonstd { namespace ring_span_lite {
+
+namespace detail {
+
+inline std::size_t popcount64( std::uint64_t x ) nsrs_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>( __builtin_popcountll( x ) );
+#else
+    x = x - ( ( x >> 1 ) & 0x5555555555555555ull );
+    x = ( x & 0x3333333333333333ull ) + ( ( x >> 2 ) & 0x3333333333333333ull );
+    x = ( x + ( x >> 4 ) ) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<std::size_t>( ( x * 0x0101010101010101ull ) >> 56 );
+#endif
+}
+
+// low n bits set, 0 <= n <= 64:
+
+inline std::uint64_t low_bits64( std::size_t n ) nsrs_noexcept
+{
+    return n < 64 ? ( std::uint64_t(1) << n ) - 1 : ~std::uint64_t(0);
+}
+
+} // namespace detail
+
+//
+// bit_ring: ring of flags over a range of 64-bit words, 64 flags per word.
+//
+// Flag i of the storage is bit i % 64 of word i / 64. push_word() appends up
+// to 64 flags at once, touching at most two words. The number of set flags
+// is maintained on every change, so that count_true() is O(1). Like
+// ring_span, pushing onto a full ring overwrites the oldest flags.
+//
+class bit_ring
+{
+public:
+    typedef std::size_t     size_type;
+    typedef std::uint64_t   word_type;
+
+    template< class ContiguousIterator >
+    bit_ring( ContiguousIterator begin, ContiguousIterator end ) nsrs_noexcept
+        : m_words    ( &* begin )
+        , m_capacity ( 64 * static_cast<size_type>( end - begin ) )
+        , m_front_idx( 0 )
+        , m_size     ( 0 )
+        , m_count    ( 0 )
+    {}
+
+    // observers:
+
+    bool empty() const nsrs_noexcept
+    {
+        return m_size == 0;
+    }
+
+    bool full() const nsrs_noexcept
+    {
+        return m_size == m_capacity;
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_size;
+    }
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_capacity;
+    }
+
+    size_type count_true() const nsrs_noexcept
+    {
+        return m_count;
+    }
+
+    size_type count_false() const nsrs_noexcept
+    {
+        return m_size - m_count;
+    }
+
+    // element access, idx counted from the front:
+
+    bool operator[]( size_type idx ) const nsrs_noexcept
+    {
+        size_type const pos = normalize_( m_front_idx + idx );
+
+        return ( ( m_words[ pos / 64 ] >> ( pos % 64 ) ) & 1 ) != 0;
+    }
+
+    bool front() const nsrs_noexcept
+    {
+        return (*this)[ 0 ];
+    }
+
+    bool back() const nsrs_noexcept
+    {
+        return (*this)[ m_size - 1 ];
+    }
+
+    void set( size_type idx, bool value ) nsrs_noexcept
+    {
+        size_type const pos = normalize_( m_front_idx + idx );
+        word_type const bit = word_type(1) << ( pos % 64 );
+        word_type & word    = m_words[ pos / 64 ];
+
+        m_count -= ( word & bit ) != 0;
+        word     = value ? word | bit : word & ~bit;
+        m_count += value;
+    }
+
+    // modifiers:
+
+    void push_back( bool value ) nsrs_noexcept
+    {
+        push_word( value ? 1 : 0, 1 );
+    }
+
+    // append the low n flags of word, bit 0 first, 1 <= n <= 64:
+
+    void push_word( word_type word, size_type n = 64 ) nsrs_noexcept
+    {
+        assert( 0 < n && n <= 64 && n <= m_capacity );
+
+        if ( m_size + n > m_capacity )
+            pop_front( m_size + n - m_capacity );
+
+        word &= detail::low_bits64( n );
+
+        size_type const pos    = normalize_( m_front_idx + m_size );
+        size_type const idx    = pos / 64;
+        size_type const offset = pos % 64;
+
+        m_words[idx] = ( m_words[idx] & ~( detail::low_bits64( n ) << offset ) ) | ( word << offset );
+
+        if ( offset + n > 64 )
+        {
+            size_type const next = idx + 1 < m_capacity / 64 ? idx + 1 : 0;
+            size_type const rest = offset + n - 64;
+
+            m_words[next] = ( m_words[next] & ~detail::low_bits64( rest ) ) | ( word >> ( 64 - offset ) );
+        }
+
+        m_size  += n;
+        m_count += detail::popcount64( word );
+    }
+
+    // append n words of 64 flags each:
+
+    void push_words( word_type const * words, size_type n ) nsrs_noexcept
+    {
+        for ( size_type i = 0; i < n; ++i )
+            push_word( words[i] );
+    }
+
+    void pop_front( size_type n = 1 ) nsrs_noexcept
+    {
+        assert( n <= m_size );
+
+        m_count    -= count_( m_front_idx, n );
+        m_front_idx = m_capacity > 0 ? normalize_( m_front_idx + n ) : 0;
+        m_size     -= n;
+    }
+
+    void clear() nsrs_noexcept
+    {
+        m_front_idx = m_size = m_count = 0;
+    }
+
+private:
+    // pos < 2 * capacity: wrap without division:
+
+    size_type normalize_( size_type pos ) const nsrs_noexcept
+    {
+        return pos >= m_capacity ? pos - m_capacity : pos;
+    }
+
+    // number of set flags at storage positions [pos, pos + n), wrapping:
+
+    size_type count_( size_type pos, size_type n ) const nsrs_noexcept
+    {
+        size_type result = 0;
+
+        while ( n > 0 )
+        {
+            size_type const offset = pos % 64;
+            size_type const take   = n < 64 - offset ? n : 64 - offset;
+
+            result += detail::popcount64( ( m_words[ pos / 64 ] >> offset ) & detail::low_bits64( take ) );
+
+            pos = normalize_( pos + take );
+            n  -= take;
+        }
+        return result;
+    }
+
+private:
+    word_type * m_words;
+    size_type   m_capacity;
+    size_type   m_front_idx;
+    size_type   m_size;
+    size_type   m_count;
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::bit_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_BIT_RING
+
+#endif // NONSTD_BIT_RING_LITE_HPP
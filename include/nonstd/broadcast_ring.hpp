@@ -0,0 +1,286 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_BROADCAST_RING_LITE_HPP
+#define NONSTD_BROADCAST_RING_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Single-writer, multi-reader broadcast ring (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_BROADCAST_RING  1
+#else
+# define nsrs_HAVE_BROADCAST_RING  0
+#endif
+
+#if nsrs_HAVE_BROADCAST_RING
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+namespace nonstd { namespace ring_span_lite {
+
+namespace detail {
+
+// Sequence counter on a cache line of its own. Padding on both sides keeps
+// it apart from its neighbours without relying on over-aligned allocation.
+
+struct padded_sequence
+{
+    padded_sequence() nsrs_noexcept
+        : value( 0 )
+    {}
+
+    char                        pad_before[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<std::uint64_t>  value;
+    std::uint64_t               local;      // owner-only: cached sequence or counter
+    char                        pad_after[ nsrs_CONFIG_CACHELINE_SIZE - sizeof(std::atomic<std::uint64_t>) - sizeof(std::uint64_t) ];
+};
+
+// smallest of the sequences, or given default if there are none:
+
+inline std::uint64_t minimum_sequence( padded_sequence const * seqs, std::size_t count, std::uint64_t dflt ) nsrs_noexcept
+{
+    std::uint64_t result = dflt;
+
+    for ( std::size_t i = 0; i < count; ++i )
+    {
+        std::uint64_t const seq = seqs[i].value.load( std::memory_order_acquire );
+
+        if ( seq < result )
+            result = seq;
+    }
+    return result;
+}
+
+} // namespace detail
+
+// What the writer does when the slowest reader is a full ring behind:
+
+enum broadcast_policy
+{
+    broadcast_block,        // wait for (try_push(): fail on) the slowest reader
+    broadcast_overwrite     // overwrite; a lagging reader skips ahead and counts its loss
+};
+
+//
+// broadcast_ring: one writer, a fixed number of readers that each see every element.
+//
+// Elements are written once into the storage given as a contiguous range with a
+// power-of-2 size; each reader advances its own cache-line padded sequence.
+//
+template< class T, broadcast_policy Policy = broadcast_block >
+class broadcast_ring
+{
+    static_assert( Policy == broadcast_block || std::is_trivially_copyable<T>::value,
+        "broadcast_overwrite requires a trivially copyable element type" );
+
+public:
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+    typedef std::uint64_t   sequence_type;
+
+    template< class ContiguousIterator >
+    broadcast_ring( ContiguousIterator begin, ContiguousIterator end, size_type readers )
+        : m_data     ( &* begin )
+        , m_mask     ( static_cast<size_type>( end - begin ) - 1 )
+        , m_readers  ( new detail::padded_sequence[ readers ] )
+        , m_reader_count( readers )
+    {
+        assert( detail::is_power_of_2( capacity() ) );
+
+        m_cursor.local = 0;         // writer: lowest reader sequence seen
+
+        for ( size_type i = 0; i < readers; ++i )
+            m_readers[i].local = 0; // reader: elements lost to overwrite
+    }
+
+    broadcast_ring( broadcast_ring const & ) = delete;
+    broadcast_ring & operator=( broadcast_ring const & ) = delete;
+
+    // observers:
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_mask + 1;
+    }
+
+    size_type readers() const nsrs_noexcept
+    {
+        return m_reader_count;
+    }
+
+    // number of elements published so far:
+
+    sequence_type published() const nsrs_noexcept
+    {
+        return m_cursor.value.load( std::memory_order_acquire );
+    }
+
+    // number of elements available to given reader:
+
+    size_type available( size_type reader ) const nsrs_noexcept
+    {
+        return static_cast<size_type>( published() - m_readers[reader].value.load( std::memory_order_relaxed ) );
+    }
+
+    // writer side:
+
+    bool try_push( T const & value ) nsrs_noexcept_op(( std::is_nothrow_copy_assignable<T>::value ))
+    {
+        return try_push_( value, std::integral_constant<bool, Policy == broadcast_block>() );
+    }
+
+    void push( T const & value ) nsrs_noexcept_op(( std::is_nothrow_copy_assignable<T>::value ))
+    {
+        while ( !try_push( value ) )
+            std::this_thread::yield();
+    }
+
+    // reader side, broadcast_block: zero-copy access to the next element:
+
+    T const * try_front( size_type reader ) const nsrs_noexcept
+    {
+        static_assert( Policy == broadcast_block, "try_front() requires broadcast_block" );
+
+        sequence_type const seq = m_readers[reader].value.load( std::memory_order_relaxed );
+
+        if ( seq == m_cursor.value.load( std::memory_order_acquire ) )
+            return nsrs_nullptr;
+
+        return m_data + ( seq & m_mask );
+    }
+
+    void pop( size_type reader ) nsrs_noexcept
+    {
+        static_assert( Policy == broadcast_block, "pop() requires broadcast_block" );
+
+        detail::padded_sequence & r = m_readers[reader];
+        r.value.store( r.value.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    // reader side, both policies: copy out the next element:
+
+    bool try_pop( size_type reader, T & value ) nsrs_noexcept_op(( std::is_nothrow_copy_assignable<T>::value ))
+    {
+        return try_pop_( reader, value, std::integral_constant<bool, Policy == broadcast_block>() );
+    }
+
+    // number of elements given reader missed because they were overwritten:
+
+    sequence_type dropped( size_type reader ) const nsrs_noexcept
+    {
+        return m_readers[reader].local;
+    }
+
+private:
+    bool try_push_( T const & value, std::true_type )
+    {
+        sequence_type const next = m_cursor.value.load( std::memory_order_relaxed );
+
+        if ( next - m_cursor.local > m_mask )
+        {
+            m_cursor.local = detail::minimum_sequence( m_readers.get(), m_reader_count, next );
+
+            if ( next - m_cursor.local > m_mask )
+                return false;
+        }
+
+        m_data[ next & m_mask ] = value;
+        m_cursor.value.store( next + 1, std::memory_order_release );
+        return true;
+    }
+
+    bool try_push_( T const & value, std::false_type )
+    {
+        sequence_type const next = m_cursor.value.load( std::memory_order_relaxed );
+
+        // readers validate their copy against the cursor (seqlock-style):
+
+        std::atomic_thread_fence( std::memory_order_release );
+        std::memcpy( static_cast<void *>( m_data + ( next & m_mask ) ), &value, sizeof(T) );
+        m_cursor.value.store( next + 1, std::memory_order_release );
+        return true;
+    }
+
+    bool try_pop_( size_type reader, T & value, std::true_type )
+    {
+        T const * const element = try_front( reader );
+
+        if ( !element )
+            return false;
+
+        value = *element;
+        pop( reader );
+        return true;
+    }
+
+    bool try_pop_( size_type reader, T & value, std::false_type )
+    {
+        detail::padded_sequence & r = m_readers[reader];
+
+        for ( ;; )
+        {
+            sequence_type seq    = r.value.load( std::memory_order_relaxed );
+            sequence_type cursor = m_cursor.value.load( std::memory_order_acquire );
+
+            if ( seq == cursor )
+                return false;
+
+            // slot of seq is being or has been rewritten when cursor - seq >= capacity:
+
+            if ( cursor - seq > m_mask )
+            {
+                r.local += cursor - m_mask - seq;
+                seq      = cursor - m_mask;
+            }
+
+            std::memcpy( static_cast<void *>( &value ), m_data + ( seq & m_mask ), sizeof(T) );
+            std::atomic_thread_fence( std::memory_order_acquire );
+
+            cursor = m_cursor.value.load( std::memory_order_relaxed );
+
+            if ( cursor - seq <= m_mask )
+            {
+                r.value.store( seq + 1, std::memory_order_release );
+                return true;
+            }
+
+            // overwritten while copying: retry from the oldest element still present:
+
+            r.value.store( seq, std::memory_order_relaxed );
+        }
+    }
+
+private:
+    T *                                         m_data;
+    size_type                                   m_mask;
+    detail::padded_sequence                     m_cursor;   // written by writer
+    std::unique_ptr<detail::padded_sequence[]>  m_readers;  // each written by its reader
+    size_type                                   m_reader_count;
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::broadcast_policy;
+using ring_span_lite::broadcast_block;
+using ring_span_lite::broadcast_overwrite;
+using ring_span_lite::broadcast_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_BROADCAST_RING
+
+#endif // NONSTD_BROADCAST_RING_LITE_HPP
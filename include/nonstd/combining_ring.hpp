@@ -0,0 +1,219 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_COMBINING_RING_LITE_HPP
+#define NONSTD_COMBINING_RING_LITE_HPP
+
+#include <nonstd/ring.hpp>
+
+// Flat-combining wrapper that lets several threads share a ring<> (C++11, extension):
+
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+# define nsrs_HAVE_COMBINING_RING  1
+#else
+# define nsrs_HAVE_COMBINING_RING  0
+#endif
+
+#if nsrs_HAVE_COMBINING_RING
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// combining_ring: a ring<> shared by a fixed number of threads via flat combining.
+//
+// Each thread publishes its operation in a cache-line padded slot of its own.
+// The thread that takes the combiner lock applies all pending operations in one
+// pass over the slots, while the others wait for their slot to be marked done.
+// The ring stays in the combiner's cache, and a push or pop of several
+// elements is a copy into or out of at most two contiguous segments. Unlike
+// ring_span, pushing onto a full ring fails instead of overwriting. Elements
+// are copied and moved while the combiner lock is held, which must not throw.
+//
+template< class Ring >
+class combining_ring
+{
+    static_assert( std::is_nothrow_copy_assignable<typename Ring::value_type>::value
+        && std::is_nothrow_move_assignable<typename Ring::value_type>::value,
+        "combining_ring requires a nothrow copy and move assignable element type" );
+
+public:
+    typedef Ring                            ring_type;
+    typedef typename Ring::value_type       value_type;
+    typedef typename Ring::size_type        size_type;
+
+    // ring of given capacity, shared by threads 0..threads-1:
+
+    combining_ring( size_type capacity, size_type threads )
+        : m_ring    ( capacity )
+        , m_requests( new request_[ threads ] )
+        , m_threads ( threads )
+        , m_locked  ( false )
+    {}
+
+    combining_ring( combining_ring const & ) = delete;
+    combining_ring & operator=( combining_ring const & ) = delete;
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_ring.capacity();
+    }
+
+    size_type threads() const nsrs_noexcept
+    {
+        return m_threads;
+    }
+
+    // operations, for thread in [0, threads()), each used by one thread at a time:
+
+    bool try_push( size_type thread, value_type const & value )
+    {
+        return push_back( thread, &value, 1 ) == 1;
+    }
+
+    bool try_pop( size_type thread, value_type & value )
+    {
+        return pop_front( thread, &value, 1 ) == 1;
+    }
+
+    // append up to count elements from first as far as they fit, return their number:
+
+    size_type push_back( size_type thread, value_type const * first, size_type count )
+    {
+        return execute_( thread, push_op_, first, nsrs_nullptr, count );
+    }
+
+    // move up to count elements from the front to out, return their number:
+
+    size_type pop_front( size_type thread, value_type * out, size_type count )
+    {
+        return execute_( thread, pop_op_, nsrs_nullptr, out, count );
+    }
+
+private:
+    enum state_ { idle_, pending_, done_ };
+    enum op_    { push_op_, pop_op_ };
+
+    struct request_
+    {
+        request_()
+            : state( idle_ ), op( push_op_ ), in( nsrs_nullptr ), out( nsrs_nullptr ), count( 0 ), result( 0 )
+        {}
+
+        std::atomic<int>    state;
+        op_                 op;
+        value_type const *  in;
+        value_type *        out;
+        size_type           count;
+        size_type           result;
+        char                pad[ nsrs_CONFIG_CACHELINE_SIZE ];
+    };
+
+    // publish the request, then combine or wait until it is done:
+
+    size_type execute_( size_type thread, op_ op, value_type const * in, value_type * out, size_type count )
+    {
+        assert( thread < m_threads );
+
+        request_ & r = m_requests[ thread ];
+
+        r.op    = op;
+        r.in    = in;
+        r.out   = out;
+        r.count = count;
+        r.state.store( pending_, std::memory_order_release );
+
+        for ( ;; )
+        {
+            if ( !m_locked.load( std::memory_order_relaxed ) && !m_locked.exchange( true, std::memory_order_acquire ) )
+            {
+                combine_();
+                m_locked.store( false, std::memory_order_release );
+            }
+
+            if ( r.state.load( std::memory_order_acquire ) == done_ )
+            {
+                r.state.store( idle_, std::memory_order_relaxed );
+                return r.result;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    // combiner: apply the pending requests of all threads:
+
+    void combine_() nsrs_noexcept
+    {
+        for ( size_type i = 0; i < m_threads; ++i )
+        {
+            request_ & r = m_requests[ i ];
+
+            if ( r.state.load( std::memory_order_acquire ) != pending_ )
+                continue;
+
+            r.result = r.op == push_op_ ? push_( r.in, r.count ) : pop_( r.out, r.count );
+            r.state.store( done_, std::memory_order_release );
+        }
+    }
+
+    size_type push_( value_type const * in, size_type count ) nsrs_noexcept
+    {
+        std::pair<value_type *, size_type> const one = m_ring.free_array_one();
+        std::pair<value_type *, size_type> const two = m_ring.free_array_two();
+
+        size_type const n1 = ( std::min )( count, one.second );
+        size_type const n2 = ( std::min )( count - n1, two.second );
+
+        std::copy( in     , in + n1     , one.first );
+        std::copy( in + n1, in + n1 + n2, two.first );
+        m_ring.commit_back( n1 + n2 );
+
+        return n1 + n2;
+    }
+
+    size_type pop_( value_type * out, size_type count ) nsrs_noexcept
+    {
+        std::pair<value_type *, size_type> const one = m_ring.array_one();
+        std::pair<value_type *, size_type> const two = m_ring.array_two();
+
+        size_type const n1 = ( std::min )( count, one.second );
+        size_type const n2 = ( std::min )( count - n1, two.second );
+
+        std::move( one.first, one.first + n1, out      );
+        std::move( two.first, two.first + n2, out + n1 );
+        m_ring.consume_front( n1 + n2 );
+
+        return n1 + n2;
+    }
+
+private:
+    Ring                            m_ring;         // combiner only
+    std::unique_ptr<request_[]>     m_requests;
+    size_type                       m_threads;
+    char                            m_pad0[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<bool>               m_locked;
+    char                            m_pad1[ nsrs_CONFIG_CACHELINE_SIZE ];
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::combining_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_COMBINING_RING
+
+#endif // NONSTD_COMBINING_RING_LITE_HPP
@@ -0,0 +1,253 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_PIPELINE_RING_LITE_HPP
+#define NONSTD_PIPELINE_RING_LITE_HPP
+
+#include <nonstd/broadcast_ring.hpp>
+
+// Ring shared by processing stages that form a dependency graph (C++11):
+
+#if nsrs_HAVE_BROADCAST_RING
+# define nsrs_HAVE_PIPELINE_RING  1
+#else
+# define nsrs_HAVE_PIPELINE_RING  0
+#endif
+
+#if nsrs_HAVE_PIPELINE_RING
+
+#include <initializer_list>
+#include <vector>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// pipeline_ring: one producer and stages that process each element in place.
+//
+// A stage may process slot i only after all of its upstream stages (or, for a
+// stage without upstream, the producer) have released it: a sequence barrier.
+// The producer may reuse a slot after all stages have released it. Stages are
+// added before processing starts; each stage is run by a single thread.
+//
+template< class T >
+class pipeline_ring
+{
+public:
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+    typedef std::size_t     stage_type;
+    typedef std::uint64_t   sequence_type;
+
+    template< class ContiguousIterator >
+    pipeline_ring( ContiguousIterator begin, ContiguousIterator end )
+        : m_data ( &* begin )
+        , m_mask ( static_cast<size_type>( end - begin ) - 1 )
+    {
+        assert( detail::is_power_of_2( capacity() ) );
+
+        m_cursor.local = 0;         // producer: lowest released sequence seen
+    }
+
+    pipeline_ring( pipeline_ring const & ) = delete;
+    pipeline_ring & operator=( pipeline_ring const & ) = delete;
+
+    // add a stage that processes elements after the given upstream stages:
+
+    stage_type add_stage( std::initializer_list<stage_type> upstream = {} )
+    {
+        stage_type const id = m_stages.size();
+
+        m_stages.push_back( std::unique_ptr<stage_>( new stage_() ) );
+        m_stages.back()->upstream.assign( upstream.begin(), upstream.end() );
+        m_stages.back()->seq.local = 0;     // stage: lowest upstream sequence seen
+
+        for ( stage_type up : upstream )
+        {
+            assert( up < id );
+            m_stages[up]->downstream = true;
+        }
+        return id;
+    }
+
+    // observers:
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_mask + 1;
+    }
+
+    size_type stages() const nsrs_noexcept
+    {
+        return m_stages.size();
+    }
+
+    // number of elements published so far:
+
+    sequence_type published() const nsrs_noexcept
+    {
+        return m_cursor.value.load( std::memory_order_acquire );
+    }
+
+    // element at given sequence:
+
+    T & operator[]( sequence_type seq ) nsrs_noexcept
+    {
+        return m_data[ seq & m_mask ];
+    }
+
+    // producer side:
+
+    T * try_claim() nsrs_noexcept
+    {
+        sequence_type const next = m_cursor.value.load( std::memory_order_relaxed );
+
+        if ( next - m_cursor.local > m_mask )
+        {
+            m_cursor.local = released_( next );
+
+            if ( next - m_cursor.local > m_mask )
+                return nsrs_nullptr;
+        }
+        return m_data + ( next & m_mask );
+    }
+
+    void publish() nsrs_noexcept
+    {
+        m_cursor.value.store( m_cursor.value.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    bool try_push( T const & value ) nsrs_noexcept_op(( std::is_nothrow_copy_assignable<T>::value ))
+    {
+        T * const slot = try_claim();
+
+        if ( !slot )
+            return false;
+
+        *slot = value;
+        publish();
+        return true;
+    }
+
+    void push( T const & value ) nsrs_noexcept_op(( std::is_nothrow_copy_assignable<T>::value ))
+    {
+        while ( !try_push( value ) )
+            std::this_thread::yield();
+    }
+
+    // stage side: next sequence of stage, and the number of elements it may process:
+
+    sequence_type position( stage_type stage ) const nsrs_noexcept
+    {
+        return m_stages[stage]->seq.value.load( std::memory_order_relaxed );
+    }
+
+    size_type available( stage_type stage ) nsrs_noexcept
+    {
+        detail::padded_sequence & s = m_stages[stage]->seq;
+        sequence_type const seq = s.value.load( std::memory_order_relaxed );
+
+        if ( seq == s.local )
+            s.local = barrier_( *m_stages[stage] );
+
+        return static_cast<size_type>( s.local - seq );
+    }
+
+    void release( stage_type stage, size_type n = 1 ) nsrs_noexcept
+    {
+        detail::padded_sequence & s = m_stages[stage]->seq;
+        sequence_type const seq = s.value.load( std::memory_order_relaxed );
+
+        assert( s.local - seq >= n );
+
+        s.value.store( seq + n, std::memory_order_release );
+    }
+
+    // process available elements in place with f( T & ) and release them;
+    // return the number of elements processed:
+
+    template< class F >
+    size_type process( stage_type stage, F f )
+    {
+        size_type const n = available( stage );
+        sequence_type const seq = position( stage );
+
+        for ( size_type i = 0; i < n; ++i )
+            f( m_data[ ( seq + i ) & m_mask ] );
+
+        if ( n > 0 )
+            release( stage, n );
+
+        return n;
+    }
+
+private:
+    struct stage_
+    {
+        stage_() : downstream( false ) {}
+
+        detail::padded_sequence     seq;
+        std::vector<stage_type>     upstream;
+        bool                        downstream;     // another stage depends on this one
+    };
+
+    // highest sequence a stage may process up to:
+
+    sequence_type barrier_( stage_ const & s ) const nsrs_noexcept
+    {
+        if ( s.upstream.empty() )
+            return m_cursor.value.load( std::memory_order_acquire );
+
+        sequence_type result = m_stages[ s.upstream[0] ]->seq.value.load( std::memory_order_acquire );
+
+        for ( size_type i = 1; i < s.upstream.size(); ++i )
+        {
+            sequence_type const seq = m_stages[ s.upstream[i] ]->seq.value.load( std::memory_order_acquire );
+
+            if ( seq < result )
+                result = seq;
+        }
+        return result;
+    }
+
+    // lowest sequence of the final stages, which trail all others:
+
+    sequence_type released_( sequence_type dflt ) const nsrs_noexcept
+    {
+        sequence_type result = dflt;
+
+        for ( size_type i = 0; i < m_stages.size(); ++i )
+        {
+            if ( m_stages[i]->downstream )
+                continue;
+
+            sequence_type const seq = m_stages[i]->seq.value.load( std::memory_order_acquire );
+
+            if ( seq < result )
+                result = seq;
+        }
+        return result;
+    }
+
+private:
+    T *                                     m_data;
+    size_type                               m_mask;
+    detail::padded_sequence                 m_cursor;   // written by producer
+    std::vector< std::unique_ptr<stage_> >  m_stages;   // each written by its stage
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::pipeline_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_PIPELINE_RING
+
+#endif // NONSTD_PIPELINE_RING_LITE_HPP
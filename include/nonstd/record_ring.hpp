@@ -0,0 +1,229 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RECORD_RING_LITE_HPP
+#define NONSTD_RECORD_RING_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Ring of variable-length records in a byte buffer (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_RECORD_RING  1
+#else
+# define nsrs_HAVE_RECORD_RING  0
+#endif
+
+#if nsrs_HAVE_RECORD_RING
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// record_ring: FIFO of [length][payload] frames in a byte range.
+//
+// Each frame has a 4-byte length header and is padded to a multiple of 4
+// bytes. A payload is always contiguous: when a frame does not fit before the
+// end of the buffer, a padding frame fills the remainder and the frame starts
+// at the beginning. push() fails when there is not enough room; front() and
+// back() give the oldest and newest payload in place.
+//
+class record_ring
+{
+public:
+    typedef std::size_t                                     size_type;
+    typedef unsigned char                                   byte_type;
+    typedef std::pair< byte_type const *, size_type >       record_type;
+
+    template< class ContiguousIterator >
+    record_ring( ContiguousIterator begin, ContiguousIterator end ) nsrs_noexcept
+        : m_data     ( begin == end ? nsrs_nullptr : reinterpret_cast<byte_type *>( &* begin ) )
+        , m_capacity ( static_cast<size_type>( end - begin ) * sizeof( *begin ) / header_size * header_size )
+        , m_front_idx( 0 )
+        , m_back_idx ( 0 )
+        , m_size     ( 0 )
+        , m_count    ( 0 )
+    {
+        static_assert( sizeof( *begin ) == 1, "record_ring requires a range of bytes" );
+    }
+
+    // observers:
+
+    bool empty() const nsrs_noexcept
+    {
+        return m_count == 0;
+    }
+
+    // number of records:
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_count;
+    }
+
+    // bytes in use, including headers and padding:
+
+    size_type bytes_used() const nsrs_noexcept
+    {
+        return m_size;
+    }
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_capacity;
+    }
+
+    // largest payload that can ever be stored, 0 if not even a header fits;
+    // its length must fit the header and differ from the padding marker:
+
+    size_type max_record_size() const nsrs_noexcept
+    {
+        size_type const room = m_capacity < header_size ? 0 : m_capacity - header_size;
+
+        return room < size_type( padding ) ? room : size_type( padding ) - 1;
+    }
+
+    // modifiers:
+
+    bool push( void const * data, size_type n ) nsrs_noexcept
+    {
+        if ( n >= padding )
+            return false;
+
+        size_type const need = frame_size_( n );
+        size_type tail = tail_();
+
+        if ( tail + need > m_capacity )
+        {
+            // frame does not fit before the end: pad and start over at the beginning:
+
+            size_type const pad = m_capacity - tail;
+
+            if ( tail < m_front_idx || m_size + pad + need > m_capacity )
+                return false;
+
+            write_header_( tail, padding );
+            m_size += pad;
+            tail    = 0;
+        }
+        else if ( m_size + need > m_capacity )
+        {
+            return false;
+        }
+
+        write_header_( tail, static_cast<std::uint32_t>( n ) );
+        std::memcpy( m_data + tail + header_size, data, n );
+
+        m_back_idx = tail;
+        m_size    += need;
+        ++m_count;
+        return true;
+    }
+
+    // push anything with data() and size(), such as std::string or std::span<const std::byte>:
+
+    template< class Span >
+    bool push( Span const & payload ) nsrs_noexcept
+    {
+        return push( payload.data(), payload.size() * sizeof( *payload.data() ) );
+    }
+
+    // oldest payload, in place:
+
+    record_type front() const nsrs_noexcept
+    {
+        assert( ! empty() );
+
+        return record_type( m_data + m_front_idx + header_size, read_header_( m_front_idx ) );
+    }
+
+    // newest payload, in place:
+
+    record_type back() const nsrs_noexcept
+    {
+        assert( ! empty() );
+
+        return record_type( m_data + m_back_idx + header_size, read_header_( m_back_idx ) );
+    }
+
+    void pop() nsrs_noexcept
+    {
+        assert( ! empty() );
+
+        consume_( frame_size_( read_header_( m_front_idx ) ) );
+
+        // start over at the beginning when empty, and skip padding at the end:
+
+        if ( --m_count == 0 )
+            clear();
+        else if ( read_header_( m_front_idx ) == padding )
+            consume_( m_capacity - m_front_idx );
+    }
+
+    void clear() nsrs_noexcept
+    {
+        m_front_idx = m_back_idx = m_size = m_count = 0;
+    }
+
+private:
+    static const size_type      header_size = sizeof( std::uint32_t );
+    static const std::uint32_t  padding     = ~std::uint32_t(0);
+
+    static size_type frame_size_( size_type n ) nsrs_noexcept
+    {
+        return header_size + ( n + header_size - 1 ) / header_size * header_size;
+    }
+
+    size_type tail_() const nsrs_noexcept
+    {
+        size_type const idx = m_front_idx + m_size;
+        return idx >= m_capacity ? idx - m_capacity : idx;
+    }
+
+    void consume_( size_type n ) nsrs_noexcept
+    {
+        m_front_idx += n;
+        m_size      -= n;
+
+        if ( m_front_idx >= m_capacity )
+            m_front_idx -= m_capacity;
+    }
+
+    std::uint32_t read_header_( size_type idx ) const nsrs_noexcept
+    {
+        std::uint32_t len; std::memcpy( &len, m_data + idx, header_size ); return len;
+    }
+
+    void write_header_( size_type idx, std::uint32_t len ) nsrs_noexcept
+    {
+        std::memcpy( m_data + idx, &len, header_size );
+    }
+
+private:
+    byte_type * m_data;
+    size_type   m_capacity;     // multiple of header_size
+    size_type   m_front_idx;
+    size_type   m_back_idx;
+    size_type   m_size;         // bytes
+    size_type   m_count;        // records
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::record_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_RECORD_RING
+
+#endif // NONSTD_RECORD_RING_LITE_HPP
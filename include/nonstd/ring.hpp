@@ -18,6 +18,16 @@
 # include <array>
 #endif
 
+// a ring of a resizable container may grow, and allocate, when pushing:
+
+#if nsrs_CPP11_OR_GREATER
+# if nsrs_RING_SPAN_LITE_EXTENSION
+#  define nsrs_RING_PUSH_NOEXCEPT(...)  noexcept( ( __VA_ARGS__ ) && !is_resizable<Container>::value )
+# else
+#  define nsrs_RING_PUSH_NOEXCEPT(...)  noexcept( __VA_ARGS__ )
+# endif
+#endif
+
 namespace nonstd { namespace ring_span_lite {
 
 namespace std11 {
@@ -59,6 +69,18 @@ struct is_std_array_oracle< std::array<T, Extent> > : std11::true_type{};
 template< class Q >
 struct is_std_array : is_std_array_oracle< Q >{};
 
+#if nsrs_CPP11_OR_GREATER
+
+// container with a resize() member, such as std::vector:
+
+template< class C, class = void >
+struct is_resizable : std::false_type{};
+
+template< class C >
+struct is_resizable< C, decltype( void( std::declval<C &>().resize( 0 ) ) ) > : std::true_type{};
+
+#endif
+
 template< typename Container >
 struct vt
 {
@@ -112,6 +134,9 @@ public:
     explicit ring()
         : cont()
         , rs( std11::begin(cont), std11::end(cont) )
+#if nsrs_RING_SPAN_LITE_EXTENSION
+        , autogrow( false )
+#endif
     {}
 
     // construct from container not being C-Array or std::array:
@@ -123,6 +148,9 @@ public:
     explicit ring( size_type capacity )
         : cont( capacity )
         , rs( cont.begin(), cont.end() )
+#if nsrs_RING_SPAN_LITE_EXTENSION
+        , autogrow( false )
+#endif
     {}
 
     // observers:
@@ -147,6 +175,74 @@ public:
         return rs.capacity();
     }
 
+#if nsrs_RING_SPAN_LITE_EXTENSION
+
+    // when set, pushing onto a full ring doubles its capacity instead of overwriting:
+
+    bool auto_grow() const nsrs_noexcept
+    {
+        return autogrow;
+    }
+
+    void set_auto_grow( bool grow ) nsrs_noexcept
+    {
+        autogrow = grow;
+    }
+
+    // capacity, for a resizable Container such as std::vector; no effect on arrays:
+
+    void reserve( size_type new_capacity )
+    {
+        if ( new_capacity > capacity() )
+            reallocate_( new_capacity );
+    }
+
+    void shrink_to_fit()
+    {
+        if ( capacity_for_( size() ) < capacity() )
+            reallocate_( size() );
+    }
+
+    // elements as a single segment, front first:
+
+    value_type * linearize()
+    {
+        return rs.linearize();
+    }
+
+    // contiguous segments, see ring_span::array_one() etc.:
+
+    std::pair<value_type *, size_type> array_one() nsrs_noexcept
+    {
+        return rs.array_one();
+    }
+
+    std::pair<value_type *, size_type> array_two() nsrs_noexcept
+    {
+        return rs.array_two();
+    }
+
+    std::pair<value_type *, size_type> free_array_one() nsrs_noexcept
+    {
+        return rs.free_array_one();
+    }
+
+    std::pair<value_type *, size_type> free_array_two() nsrs_noexcept
+    {
+        return rs.free_array_two();
+    }
+
+    void commit_back( size_type n ) nsrs_noexcept
+    {
+        rs.commit_back( n );
+    }
+
+    void consume_front( size_type n ) nsrs_noexcept
+    {
+        rs.consume_front( n );
+    }
+#endif
+
     // element access:
 
     reference front() nsrs_noexcept
@@ -262,18 +358,36 @@ public:
 
 #if nsrs_CPP11_OR_GREATER
     nsrs_REQUIRES_0( std::is_copy_assignable<value_type>::value )
-    void push_back( value_type const & value) noexcept( std::is_nothrow_copy_assignable<value_type>::value )
+    void push_back( value_type const & value) nsrs_RING_PUSH_NOEXCEPT( std::is_nothrow_copy_assignable<value_type>::value )
 #else
     void push_back( value_type const & value )
 #endif
     {
+#if nsrs_RING_SPAN_LITE_EXTENSION
+        if ( must_grow_() )
+        {
+            value_type const copy( value );     // value may refer into the ring
+            grow_();
+            rs.push_back( copy );
+            return;
+        }
+#endif
         rs.push_back( value );
     }
 
 #if nsrs_CPP11_OR_GREATER
     nsrs_REQUIRES_0( std::is_move_assignable<value_type>::value )
-    void push_back( value_type && value ) noexcept( std::is_nothrow_move_assignable<value_type>::value )
+    void push_back( value_type && value ) nsrs_RING_PUSH_NOEXCEPT( std::is_nothrow_move_assignable<value_type>::value )
     {
+#if nsrs_RING_SPAN_LITE_EXTENSION
+        if ( must_grow_() )
+        {
+            value_type moved( std::move( value ) );
+            grow_();
+            rs.push_back( std::move( moved ) );
+            return;
+        }
+#endif
         rs.push_back( std::move( value ) );
     }
 
@@ -283,12 +397,21 @@ public:
             && std::is_move_assignable<value_type>::value
         )
     >
-    void emplace_back( Args &&... args ) noexcept
+    void emplace_back( Args &&... args ) nsrs_RING_PUSH_NOEXCEPT
     (
         std::is_nothrow_constructible<value_type, Args...>::value
         && std::is_nothrow_move_assignable<value_type>::value
     )
     {
+#if nsrs_RING_SPAN_LITE_EXTENSION
+        if ( must_grow_() )
+        {
+            value_type value( std::forward<Args>(args)... );
+            grow_();
+            rs.push_back( std::move( value ) );
+            return;
+        }
+#endif
         rs.emplace_back( std::forward<Args>(args)... );
     }
 #endif
@@ -297,18 +420,32 @@ public:
 
 #if nsrs_CPP11_OR_GREATER
     nsrs_REQUIRES_0( std::is_copy_assignable<value_type>::value )
-    void push_front( value_type const & value ) noexcept(( std::is_nothrow_copy_assignable<value_type>::value ))
+    void push_front( value_type const & value ) nsrs_RING_PUSH_NOEXCEPT(( std::is_nothrow_copy_assignable<value_type>::value ))
 #else
     void push_front( value_type const & value )
 #endif
     {
+        if ( must_grow_() )
+        {
+            value_type const copy( value );     // value may refer into the ring
+            grow_();
+            rs.push_front( copy );
+            return;
+        }
         rs.push_front( value );
     }
 
 #if nsrs_CPP11_OR_GREATER
     nsrs_REQUIRES_0( std::is_move_assignable<value_type>::value )
-    void push_front( value_type && value ) noexcept(( std::is_nothrow_move_assignable<value_type>::value ))
+    void push_front( value_type && value ) nsrs_RING_PUSH_NOEXCEPT(( std::is_nothrow_move_assignable<value_type>::value ))
     {
+        if ( must_grow_() )
+        {
+            value_type moved( std::move( value ) );
+            grow_();
+            rs.push_front( std::move( moved ) );
+            return;
+        }
         rs.push_front( std::move( value ) );
     }
 
@@ -318,17 +455,33 @@ public:
             && std::is_move_assignable<value_type>::value
         )
     >
-    void emplace_front( Args&&... args ) noexcept
+    void emplace_front( Args&&... args ) nsrs_RING_PUSH_NOEXCEPT
     (
         std::is_nothrow_constructible<value_type, Args...>::value
         && std::is_nothrow_move_assignable<value_type>::value
     )
     {
+        if ( must_grow_() )
+        {
+            value_type value( std::forward<Args>(args)... );
+            grow_();
+            rs.push_front( std::move( value ) );
+            return;
+        }
         rs.emplace_front( std::forward<Args>(args)... );
     }
 #endif
 #endif // nsrs_RING_SPAN_LITE_EXTENSION
 
+#if nsrs_RING_SPAN_LITE_EXTENSION
+    // remove all elements, see ring_span::clear():
+
+    void clear()
+    {
+        rs.clear();
+    }
+#endif
+
     // swap:
 
     void swap( ring & rhs )
@@ -341,9 +494,59 @@ public:
         rhs.swap( *this );
     }
 
+private:
+#if nsrs_RING_SPAN_LITE_EXTENSION
+
+    bool must_grow_() const nsrs_noexcept
+    {
+        return autogrow && rs.full();
+    }
+
+    void grow_()
+    {
+        reallocate_( capacity() > 0 ? 2 * capacity() : 1 );
+    }
+
+    // smallest capacity of at least n, a power of 2 if required:
+
+    static size_type capacity_for_( size_type n ) nsrs_noexcept
+    {
+        size_type capacity = n > 0 ? n : 1;
+
+        if ( CapacityIsPowerOf2 )
+        {
+            capacity = 1;
+            while ( capacity < n )
+                capacity *= 2;
+        }
+        return capacity;
+    }
+
+    void reallocate_( size_type new_capacity )
+    {
+        reallocate_( new_capacity, std17::bool_constant<
+            !is_array<Container>::value && !is_std_array<Container>::value >() );
+    }
+
+    void reallocate_( size_type, std11::false_type ) nsrs_noexcept {}
+
+    // move the elements to the start of a new container, front to back:
+
+    void reallocate_( size_type new_capacity, std11::true_type )
+    {
+        Container tmp( capacity_for_( new_capacity ) );
+
+        rs.migrate_to( std11::begin(tmp), std11::end(tmp) );
+        cont.swap( tmp );                   // the buffer changes owner, not place
+    }
+#endif
+
 private:
     Container cont;
     RingSpan  rs;
+#if nsrs_RING_SPAN_LITE_EXTENSION
+    bool      autogrow;
+#endif
 };
 
 } // namespace ring_span_lite
@@ -354,4 +557,8 @@ using ring_span_lite::ring;
 
 } // namespace nonstd
 
+#if nsrs_CPP11_OR_GREATER
+# undef nsrs_RING_PUSH_NOEXCEPT
+#endif
+
 #endif // NONSTD_RING_LITE_HPP
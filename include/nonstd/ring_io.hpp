@@ -0,0 +1,105 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RING_IO_LITE_HPP
+#define NONSTD_RING_IO_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Scatter/gather I/O between a file descriptor and a byte ring (POSIX, extension):
+
+#if nsrs_RING_SPAN_LITE_EXTENSION && ( defined(__unix__) || defined(__APPLE__) )
+# define nsrs_HAVE_RING_IO  1
+#else
+# define nsrs_HAVE_RING_IO  0
+#endif
+
+#if nsrs_HAVE_RING_IO
+
+#include <cerrno>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+namespace nonstd { namespace ring_span_lite {
+
+namespace detail {
+
+template< typename T >
+inline int make_iovec( ::iovec (&iov)[2], std::pair<T *, std::size_t> one, std::pair<T *, std::size_t> two ) nsrs_noexcept
+{
+    iov[0].iov_base = one.first; iov[0].iov_len = one.second;
+    iov[1].iov_base = two.first; iov[1].iov_len = two.second;
+
+    return two.second > 0 ? 2 : 1;
+}
+
+} // namespace detail
+
+// Read from fd into the free segments of the ring with a single readv()
+// and append the bytes read. Returns the number of bytes read, 0 at
+// end-of-file, or -1 with errno set; ENOBUFS if the ring is full.
+
+template< class T, class Popper, bool CapacityIsPowerOf2, class IndexType >
+inline ::ssize_t read_into( int fd, ring_span<T, Popper, CapacityIsPowerOf2, IndexType> & ring )
+{
+#if nsrs_CPP11_OR_GREATER
+    static_assert( sizeof(T) == 1, "read_into() requires a ring of bytes" );
+#endif
+    if ( ring.full() )
+    {
+        errno = ENOBUFS;
+        return -1;
+    }
+
+    ::iovec iov[2];
+    int const count = detail::make_iovec( iov, ring.free_array_one(), ring.free_array_two() );
+
+    ::ssize_t const result = ::readv( fd, iov, count );
+
+    if ( result > 0 )
+        ring.commit_back( static_cast<std::size_t>( result ) );
+
+    return result;
+}
+
+// Write the elements of the ring to fd with a single writev() and remove
+// the bytes written from the front. Returns the number of bytes written,
+// or -1 with errno set; 0 if the ring is empty.
+
+template< class T, class Popper, bool CapacityIsPowerOf2, class IndexType >
+inline ::ssize_t write_from( int fd, ring_span<T, Popper, CapacityIsPowerOf2, IndexType> & ring )
+{
+#if nsrs_CPP11_OR_GREATER
+    static_assert( sizeof(T) == 1, "write_from() requires a ring of bytes" );
+#endif
+    if ( ring.empty() )
+        return 0;
+
+    ::iovec iov[2];
+    int const count = detail::make_iovec( iov, ring.array_one(), ring.array_two() );
+
+    ::ssize_t const result = ::writev( fd, iov, count );
+
+    if ( result > 0 )
+        ring.consume_front( static_cast<std::size_t>( result ) );
+
+    return result;
+}
+
+} // namespace ring_span_lite
+
+// Make functions available in namespace nonstd:
+
+using ring_span_lite::read_into;
+using ring_span_lite::write_from;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_RING_IO
+
+#endif // NONSTD_RING_IO_LITE_HPP
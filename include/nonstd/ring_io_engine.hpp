@@ -0,0 +1,568 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RING_IO_ENGINE_LITE_HPP
+#define NONSTD_RING_IO_ENGINE_LITE_HPP
+
+#include <nonstd/ring_io.hpp>
+
+// Engine that keeps many byte rings fed from many file descriptors (C++11, POSIX):
+
+#if nsrs_HAVE_RING_IO && nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_RING_IO_ENGINE  1
+#else
+# define nsrs_HAVE_RING_IO_ENGINE  0
+#endif
+
+// io_uring via raw system calls (Linux); otherwise only the poll() backend:
+
+#if nsrs_HAVE_RING_IO_ENGINE && defined(__linux__) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  include <sys/syscall.h>
+#  if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#   define nsrs_HAVE_IO_URING  1
+#  endif
+# endif
+#endif
+
+#ifndef  nsrs_HAVE_IO_URING
+# define nsrs_HAVE_IO_URING  0
+#endif
+
+#if nsrs_HAVE_RING_IO_ENGINE
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if nsrs_HAVE_IO_URING
+# include <linux/io_uring.h>
+#endif
+
+namespace nonstd { namespace ring_span_lite {
+
+#if nsrs_HAVE_IO_URING
+
+namespace detail {
+
+// Minimal io_uring instance: submission and completion rings mapped
+// from the kernel, accessed with acquire/release atomics.
+
+class io_uring_queue
+{
+public:
+    io_uring_queue() nsrs_noexcept
+        : m_fd( -1 ), m_sq_ptr( nsrs_nullptr ), m_cq_ptr( nsrs_nullptr ), m_sqes( nsrs_nullptr )
+        , m_sq_bytes( 0 ), m_cq_bytes( 0 ), m_sqes_bytes( 0 )
+        , m_sq_head( nsrs_nullptr ), m_sq_tail( nsrs_nullptr ), m_sq_mask( nsrs_nullptr ), m_sq_array( nsrs_nullptr )
+        , m_cq_head( nsrs_nullptr ), m_cq_tail( nsrs_nullptr ), m_cq_mask( nsrs_nullptr ), m_cqes( nsrs_nullptr )
+        , m_sq_entries( 0 ), m_pending( 0 )
+    {}
+
+    ~io_uring_queue()
+    {
+        close();
+    }
+
+    io_uring_queue( io_uring_queue const & ) = delete;
+    io_uring_queue & operator=( io_uring_queue const & ) = delete;
+
+    // returns 0 or errno:
+
+    int open( unsigned entries ) nsrs_noexcept
+    {
+        ::io_uring_params params;
+        std::memset( &params, 0, sizeof(params) );
+
+        m_fd = static_cast<int>( ::syscall( __NR_io_uring_setup, entries, &params ) );
+
+        if ( m_fd < 0 )
+        {
+            int const error = errno; m_fd = -1; return error;
+        }
+
+        m_sq_bytes   = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cq_bytes   = params.cq_off.cqes  + params.cq_entries * sizeof(::io_uring_cqe);
+        m_sqes_bytes = params.sq_entries * sizeof(::io_uring_sqe);
+
+        if ( params.features & IORING_FEAT_SINGLE_MMAP )
+        {
+            m_sq_bytes = m_cq_bytes = m_sq_bytes > m_cq_bytes ? m_sq_bytes : m_cq_bytes;
+        }
+
+        m_sq_ptr = map_( m_sq_bytes, IORING_OFF_SQ_RING );
+        m_cq_ptr = params.features & IORING_FEAT_SINGLE_MMAP ? m_sq_ptr : map_( m_cq_bytes, IORING_OFF_CQ_RING );
+        m_sqes   = static_cast< ::io_uring_sqe *>( map_( m_sqes_bytes, IORING_OFF_SQES ) );
+
+        if ( !m_sq_ptr || !m_cq_ptr || !m_sqes )
+        {
+            int const error = errno; close(); return error;
+        }
+
+        char * sq = static_cast<char *>( m_sq_ptr );
+        char * cq = static_cast<char *>( m_cq_ptr );
+
+        m_sq_head  = reinterpret_cast<unsigned *>( sq + params.sq_off.head );
+        m_sq_tail  = reinterpret_cast<unsigned *>( sq + params.sq_off.tail );
+        m_sq_mask  = reinterpret_cast<unsigned *>( sq + params.sq_off.ring_mask );
+        m_sq_array = reinterpret_cast<unsigned *>( sq + params.sq_off.array );
+        m_cq_head  = reinterpret_cast<unsigned *>( cq + params.cq_off.head );
+        m_cq_tail  = reinterpret_cast<unsigned *>( cq + params.cq_off.tail );
+        m_cq_mask  = reinterpret_cast<unsigned *>( cq + params.cq_off.ring_mask );
+        m_cqes     = reinterpret_cast< ::io_uring_cqe *>( cq + params.cq_off.cqes );
+
+        m_sq_entries = params.sq_entries;
+        return 0;
+    }
+
+    void close() nsrs_noexcept
+    {
+        if ( m_sqes )
+            ::munmap( m_sqes, m_sqes_bytes );
+        if ( m_cq_ptr && m_cq_ptr != m_sq_ptr )
+            ::munmap( m_cq_ptr, m_cq_bytes );
+        if ( m_sq_ptr )
+            ::munmap( m_sq_ptr, m_sq_bytes );
+        if ( m_fd >= 0 )
+            ::close( m_fd );
+
+        m_fd = -1; m_sq_ptr = m_cq_ptr = nsrs_nullptr; m_sqes = nsrs_nullptr;
+    }
+
+    bool is_open() const nsrs_noexcept
+    {
+        return m_fd >= 0;
+    }
+
+    unsigned entries() const nsrs_noexcept
+    {
+        return m_sq_entries;
+    }
+
+    // queue a readv; false if the submission ring is full:
+
+    bool prepare_readv( int fd, ::iovec const * iov, unsigned count, std::uint64_t offset, std::uint64_t user_data ) nsrs_noexcept
+    {
+        ::io_uring_sqe * sqe = next_sqe_();
+
+        if ( !sqe )
+            return false;
+
+        sqe->opcode    = IORING_OP_READV;
+        sqe->fd        = fd;
+        sqe->addr      = reinterpret_cast<std::uint64_t>( iov );
+        sqe->len       = count;
+        sqe->off       = offset;
+        sqe->user_data = user_data;
+        return true;
+    }
+
+    // queue the cancellation of the request tagged target; false if the submission ring is full:
+
+    bool prepare_cancel( std::uint64_t target, std::uint64_t user_data ) nsrs_noexcept
+    {
+        ::io_uring_sqe * sqe = next_sqe_();
+
+        if ( !sqe )
+            return false;
+
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = target;
+        sqe->user_data = user_data;
+        return true;
+    }
+
+    // publish queued submissions and optionally wait for a completion; returns 0 or errno:
+
+    int submit( bool wait ) nsrs_noexcept
+    {
+        unsigned const count = m_pending;
+
+        __atomic_store_n( m_sq_tail, *m_sq_tail + count, __ATOMIC_RELEASE );
+        m_pending = 0;
+
+        if ( count == 0 && !wait )
+            return 0;
+
+        for ( ;; )
+        {
+            long const result = ::syscall( __NR_io_uring_enter, m_fd, count, wait ? 1u : 0u, wait ? IORING_ENTER_GETEVENTS : 0u, nsrs_nullptr, 0 );
+
+            if ( result >= 0 )
+                return 0;
+            if ( errno != EINTR )
+                return errno;
+        }
+    }
+
+    // visit available completions as f( user_data, result ); returns their number:
+
+    template< typename F >
+    unsigned for_each_completion( F f )
+    {
+        unsigned       head = *m_cq_head;
+        unsigned const tail = __atomic_load_n( m_cq_tail, __ATOMIC_ACQUIRE );
+        unsigned       count = 0;
+
+        for ( ; head != tail; ++head, ++count )
+        {
+            ::io_uring_cqe const & cqe = m_cqes[ head & *m_cq_mask ];
+            f( cqe.user_data, cqe.res );
+        }
+
+        __atomic_store_n( m_cq_head, head, __ATOMIC_RELEASE );
+        return count;
+    }
+
+private:
+    // cleared entry queued behind the pending ones, or null if the submission ring is full:
+
+    ::io_uring_sqe * next_sqe_() nsrs_noexcept
+    {
+        unsigned const head = __atomic_load_n( m_sq_head, __ATOMIC_ACQUIRE );
+        unsigned const tail = *m_sq_tail + m_pending;
+
+        if ( tail - head >= m_sq_entries )
+            return nsrs_nullptr;
+
+        unsigned const idx = tail & *m_sq_mask;
+        ::io_uring_sqe * sqe = &m_sqes[ idx ];
+
+        std::memset( sqe, 0, sizeof(*sqe) );
+        m_sq_array[ idx ] = idx;
+        ++m_pending;
+        return sqe;
+    }
+
+    void * map_( std::size_t bytes, unsigned long long offset ) nsrs_noexcept
+    {
+        void * ptr = ::mmap( nsrs_nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, static_cast< ::off_t >( offset ) );
+        return ptr == MAP_FAILED ? nsrs_nullptr : ptr;
+    }
+
+private:
+    int             m_fd;
+    void *          m_sq_ptr;
+    void *          m_cq_ptr;
+    ::io_uring_sqe * m_sqes;
+    std::size_t     m_sq_bytes;
+    std::size_t     m_cq_bytes;
+    std::size_t     m_sqes_bytes;
+    unsigned *      m_sq_head;
+    unsigned *      m_sq_tail;
+    unsigned *      m_sq_mask;
+    unsigned *      m_sq_array;
+    unsigned *      m_cq_head;
+    unsigned *      m_cq_tail;
+    unsigned *      m_cq_mask;
+    ::io_uring_cqe * m_cqes;
+    unsigned        m_sq_entries;
+    unsigned        m_pending;
+};
+
+} // namespace detail
+
+#endif // nsrs_HAVE_IO_URING
+
+//
+// ring_io_engine: feed byte rings from file descriptors without a thread per descriptor.
+//
+// Reads go straight into the free segments of each ring. A source has at most
+// one read in flight; the ring's owner may pop elements from the front meanwhile,
+// but must not push to it. Received bytes are committed on completion. Each ring
+// must outlive the engine: its destructor cancels the reads still in flight and
+// waits for them to complete.
+//
+template< class RingSpan >
+class ring_io_engine
+{
+public:
+    enum backend_type { backend_io_uring, backend_poll };
+
+    typedef std::size_t source_id;
+
+    explicit ring_io_engine( unsigned queue_depth = 64, bool force_poll = false )
+        : m_backend( backend_poll )
+        , m_in_flight( 0 )
+    {
+#if nsrs_HAVE_IO_URING
+        if ( !force_poll && m_uring.open( queue_depth ) == 0 )
+            m_backend = backend_io_uring;
+#else
+        (void) queue_depth; (void) force_poll;
+#endif
+    }
+
+#if nsrs_HAVE_IO_URING
+    ~ring_io_engine()
+    {
+        if ( m_backend == backend_io_uring )
+            cancel_uring_();
+    }
+#endif
+
+    ring_io_engine( ring_io_engine const & ) = delete;
+    ring_io_engine & operator=( ring_io_engine const & ) = delete;
+
+    backend_type backend() const nsrs_noexcept
+    {
+        return m_backend;
+    }
+
+    // register a descriptor and the ring it feeds; fd remains owned by caller:
+
+    source_id add( int fd, RingSpan & ring )
+    {
+        source s = { fd, &ring, {}, seek_offset_( fd ), false, false, 0 };
+        m_sources.push_back( s );
+        return m_sources.size() - 1;
+    }
+
+    // observers:
+
+    std::size_t size() const nsrs_noexcept
+    {
+        return m_sources.size();
+    }
+
+    bool eof( source_id id ) const nsrs_noexcept
+    {
+        return m_sources[id].eof;
+    }
+
+    int error( source_id id ) const nsrs_noexcept
+    {
+        return m_sources[id].error;
+    }
+
+    // number of sources that did not yet reach end-of-file or an error:
+
+    std::size_t active() const nsrs_noexcept
+    {
+        std::size_t count = 0;
+        for ( std::size_t i = 0; i < m_sources.size(); ++i )
+            count += ! done_( m_sources[i] );
+        return count;
+    }
+
+    // Issue reads for sources with room in their ring and handle completions,
+    // waiting for at least one if requested and if any read can make progress.
+    // Returns the number of reads completed, or -errno.
+
+    int run_once( bool wait = true )
+    {
+#if nsrs_HAVE_IO_URING
+        if ( m_backend == backend_io_uring )
+            return run_uring_( wait );
+#endif
+        return run_poll_( wait );
+    }
+
+private:
+    struct source
+    {
+        int             fd;
+        RingSpan *      ring;
+        ::iovec         iov[2];
+        std::int64_t    offset;     // next file offset, -1 if not seekable
+        bool            in_flight;
+        bool            eof;
+        int             error;
+    };
+
+    static std::int64_t seek_offset_( int fd ) nsrs_noexcept
+    {
+        ::off_t const pos = ::lseek( fd, 0, SEEK_CUR );
+        return pos < 0 ? -1 : static_cast<std::int64_t>( pos );
+    }
+
+    static bool done_( source const & s ) nsrs_noexcept
+    {
+        return s.eof || s.error != 0;
+    }
+
+    static bool can_read_( source const & s ) nsrs_noexcept
+    {
+        return !done_( s ) && !s.in_flight && !s.ring->full();
+    }
+
+    // commit bytes read into the free segments and update state:
+
+    void complete_( source & s, long result ) nsrs_noexcept
+    {
+        if ( result > 0 )
+        {
+            s.ring->commit_back( static_cast<std::size_t>( result ) );
+
+            if ( s.offset >= 0 )
+                s.offset += result;
+        }
+        update_state_( s, result );
+    }
+
+    static void update_state_( source & s, long result ) nsrs_noexcept
+    {
+        if ( result == 0 )
+        {
+            s.eof = true;
+        }
+        else if ( result < 0 && result != -EAGAIN && result != -EINTR )
+        {
+            s.error = static_cast<int>( -result );
+        }
+    }
+
+#if nsrs_HAVE_IO_URING
+    int run_uring_( bool wait )
+    {
+        for ( std::size_t i = 0; i < m_sources.size(); ++i )
+        {
+            source & s = m_sources[i];
+
+            if ( !can_read_( s ) )
+                continue;
+
+            unsigned const count = static_cast<unsigned>( detail::make_iovec( s.iov, s.ring->free_array_one(), s.ring->free_array_two() ) );
+            std::uint64_t const offset = s.offset >= 0 ? static_cast<std::uint64_t>( s.offset ) : 0;
+
+            if ( !m_uring.prepare_readv( s.fd, s.iov, count, offset, i ) )
+                break;
+
+            s.in_flight = true;
+            ++m_in_flight;
+        }
+
+        int const error = m_uring.submit( wait && m_in_flight > 0 );
+
+        if ( error != 0 )
+            return -error;
+
+        return static_cast<int>( m_uring.for_each_completion( completion_( *this ) ) );
+    }
+
+    // the kernel may still write into a ring: cancel in-flight reads and reap them:
+
+    void cancel_uring_() nsrs_noexcept
+    {
+        for ( std::size_t i = 0; i < m_sources.size(); ++i )
+        {
+            if ( !m_sources[i].in_flight )
+                continue;
+
+            while ( !m_uring.prepare_cancel( i, cancel_tag_ ) )
+            {
+                if ( m_uring.submit( false ) != 0 )
+                    break;
+            }
+        }
+
+        while ( m_in_flight > 0 )
+        {
+            if ( m_uring.submit( true ) != 0 )
+                break;
+
+            m_uring.for_each_completion( completion_( *this ) );
+        }
+    }
+
+    static std::uint64_t const cancel_tag_ = ~std::uint64_t( 0 );
+
+    struct completion_
+    {
+        ring_io_engine & engine;
+
+        explicit completion_( ring_io_engine & e ) : engine( e ) {}
+
+        void operator()( std::uint64_t id, long result ) const nsrs_noexcept
+        {
+            if ( id == cancel_tag_ )
+                return;
+
+            source & s = engine.m_sources[ static_cast<std::size_t>( id ) ];
+
+            s.in_flight = false;
+            --engine.m_in_flight;
+            engine.complete_( s, result );
+        }
+    };
+#endif // nsrs_HAVE_IO_URING
+
+    int run_poll_( bool wait )
+    {
+        m_pollfds.clear();
+        m_polled.clear();
+
+        for ( std::size_t i = 0; i < m_sources.size(); ++i )
+        {
+            if ( !can_read_( m_sources[i] ) )
+                continue;
+
+            ::pollfd pfd = { m_sources[i].fd, POLLIN, 0 };
+            m_pollfds.push_back( pfd );
+            m_polled.push_back( i );
+        }
+
+        if ( m_pollfds.empty() )
+            return 0;
+
+        int const ready = ::poll( &m_pollfds[0], static_cast< ::nfds_t >( m_pollfds.size() ), wait ? -1 : 0 );
+
+        if ( ready < 0 )
+            return errno == EINTR ? 0 : -errno;
+
+        int completed = 0;
+
+        for ( std::size_t k = 0; k < m_pollfds.size(); ++k )
+        {
+            if ( m_pollfds[k].revents == 0 )
+                continue;
+
+            // read_into() commits the bytes read:
+
+            source & s = m_sources[ m_polled[k] ];
+            ::ssize_t const result = read_into( s.fd, *s.ring );
+
+            update_state_( s, result < 0 ? -errno : static_cast<long>( result ) );
+            ++completed;
+        }
+        return completed;
+    }
+
+private:
+    backend_type            m_backend;
+    std::size_t             m_in_flight;
+    std::vector<source>     m_sources;
+    std::vector< ::pollfd>  m_pollfds;
+    std::vector<std::size_t> m_polled;
+#if nsrs_HAVE_IO_URING
+    detail::io_uring_queue  m_uring;
+#endif
+};
+
+#if nsrs_HAVE_IO_URING
+template< class RingSpan >
+std::uint64_t const ring_io_engine<RingSpan>::cancel_tag_;
+#endif
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::ring_io_engine;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_RING_IO_ENGINE
+
+#endif // NONSTD_RING_IO_ENGINE_LITE_HPP
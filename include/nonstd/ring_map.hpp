@@ -0,0 +1,431 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RING_MAP_LITE_HPP
+#define NONSTD_RING_MAP_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Open-addressing map of keys to inline fixed-capacity rings, with LRU eviction (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_RING_MAP  1
+#else
+# define nsrs_HAVE_RING_MAP  0
+#endif
+
+#if nsrs_HAVE_RING_MAP
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// ring_map: the last N values per key, within a budget of elements.
+//
+// Each slot of the linear-probing table holds a key with a ring of up to N
+// values inline, so push_back( key, value ) is one probe and no allocation.
+// Keys are kept in least recently touched order. A new key beyond max_keys,
+// or a push that takes the number of values held beyond the budget, evicts
+// the least recently touched keys. The budget counts values, not bytes: the
+// table of slots for max_keys keys is allocated up front. A slot that is
+// vacated releases its key and values by assigning Key() and T(), unless
+// both are trivially destructible. Erasure shifts later slots back instead
+// of leaving tombstones.
+//
+template
+<
+    class Key
+    , class T
+    , std::size_t N
+    , class Hash = std::hash<Key>
+    , class KeyEqual = std::equal_to<Key>
+>
+class ring_map
+{
+    struct slot_;
+
+public:
+    typedef Key             key_type;
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+
+    // read-only view of the values of a key, oldest first; empty if absent:
+
+    class view
+    {
+    public:
+        bool empty() const nsrs_noexcept
+        {
+            return size() == 0;
+        }
+
+        size_type size() const nsrs_noexcept
+        {
+            return m_slot ? m_slot->size : 0;
+        }
+
+        T const & operator[]( size_type idx ) const nsrs_noexcept
+        {
+            assert( idx < size() );
+            return m_slot->items[ ( m_slot->front + idx ) % N ];
+        }
+
+        T const & front() const nsrs_noexcept
+        {
+            return (*this)[ 0 ];
+        }
+
+        T const & back() const nsrs_noexcept
+        {
+            return (*this)[ size() - 1 ];
+        }
+
+    private:
+        friend class ring_map;
+
+        explicit view( slot_ const * slot ) nsrs_noexcept
+            : m_slot( slot )
+        {}
+
+        slot_ const * m_slot;
+    };
+
+    // up to max_keys keys, holding up to budget values together:
+
+    ring_map( size_type max_keys, size_type budget )
+        : m_slots( table_size_( max_keys ) )
+        , m_mask( m_slots.size() - 1 )
+        , m_max_keys( max_keys )
+        , m_budget( budget )
+        , m_keys( 0 )
+        , m_elements( 0 )
+        , m_head( npos_ )
+        , m_tail( npos_ )
+    {
+        assert( max_keys > 0 && budget >= N );
+    }
+
+    ring_map( ring_map const & ) = delete;
+    ring_map & operator=( ring_map const & ) = delete;
+
+    // observers:
+
+    bool empty() const nsrs_noexcept
+    {
+        return m_keys == 0;
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_keys;
+    }
+
+    size_type max_keys() const nsrs_noexcept
+    {
+        return m_max_keys;
+    }
+
+    // number of values held by all keys, and its upper bound:
+
+    size_type elements() const nsrs_noexcept
+    {
+        return m_elements;
+    }
+
+    size_type budget() const nsrs_noexcept
+    {
+        return m_budget;
+    }
+
+    static size_type ring_capacity() nsrs_noexcept
+    {
+        return N;
+    }
+
+    // lookup, does not touch the key:
+
+    bool contains( Key const & key ) const
+    {
+        return find_( key, Hash()( key ) ) != npos_;
+    }
+
+    view find( Key const & key ) const
+    {
+        size_type const i = find_( key, Hash()( key ) );
+        return view( i != npos_ ? &m_slots[ i ] : nsrs_nullptr );
+    }
+
+    // modifiers:
+
+    // append value to the ring of key, inserting the key if absent:
+
+    void push_back( Key const & key, T const & value )
+    {
+        upsert_( key, Hash()( key ), value );
+        enforce_budget_();
+    }
+
+    // batch of pair-like (key, value) elements, prefetching upcoming slots:
+
+    template< class InputIt >
+    void push_back( InputIt first, InputIt last )
+    {
+        size_type const window = 8;
+        size_type hash[ window ];
+
+        while ( first != last )
+        {
+            InputIt it = first;
+            size_type n = 0;
+
+            for ( ; n < window && it != last; ++n, ++it )
+            {
+                hash[ n ] = Hash()( it->first );
+#if defined( __GNUC__ )
+                __builtin_prefetch( &m_slots[ hash[ n ] & m_mask ] );
+#endif
+            }
+
+            for ( size_type k = 0; k < n; ++k, ++first )
+                upsert_( first->first, hash[ k ], first->second );
+        }
+        enforce_budget_();
+    }
+
+    bool erase( Key const & key )
+    {
+        size_type const i = find_( key, Hash()( key ) );
+
+        if ( i == npos_ )
+            return false;
+
+        erase_at_( i );
+        return true;
+    }
+
+    void clear()
+    {
+        while ( m_tail != npos_ )
+            erase_at_( m_tail );
+    }
+
+private:
+    typedef std::uint32_t index_type;
+
+    static index_type const npos_ = ~index_type( 0 );
+
+    struct slot_
+    {
+        slot_()
+            : items(), hash( 0 ), front( 0 ), size( 0 ), prev( npos_ ), next( npos_ ), used( false )
+        {}
+
+        Key         key;
+        T           items[ N ];
+        size_type   hash;
+        index_type  front;
+        index_type  size;
+        index_type  prev;       // more recently touched
+        index_type  next;       // less recently touched
+        bool        used;
+    };
+
+    // power of 2, at most 3/4 full:
+
+    static size_type table_size_( size_type max_keys ) nsrs_noexcept
+    {
+        size_type size = 1;
+        while ( size * 3 < max_keys * 4 + 1 )
+            size *= 2;
+        return size;
+    }
+
+    size_type find_( Key const & key, size_type hash ) const
+    {
+        for ( size_type i = hash & m_mask; m_slots[ i ].used; i = ( i + 1 ) & m_mask )
+        {
+            if ( m_slots[ i ].hash == hash && KeyEqual()( m_slots[ i ].key, key ) )
+                return i;
+        }
+        return npos_;
+    }
+
+    void upsert_( Key const & key, size_type hash, T const & value )
+    {
+        size_type i = hash & m_mask;
+
+        for ( ; m_slots[ i ].used; i = ( i + 1 ) & m_mask )
+        {
+            if ( m_slots[ i ].hash == hash && KeyEqual()( m_slots[ i ].key, key ) )
+            {
+                unlink_( i );
+                break;
+            }
+        }
+
+        if ( ! m_slots[ i ].used )
+        {
+            if ( m_keys == m_max_keys )
+            {
+                // evicting shifts slots: probe again:
+
+                erase_at_( m_tail );
+
+                for ( i = hash & m_mask; m_slots[ i ].used; i = ( i + 1 ) & m_mask ) {}
+            }
+
+            slot_ & slot = m_slots[ i ];
+            slot.key   = key;
+            slot.hash  = hash;
+            slot.front = 0;
+            slot.size  = 0;
+            slot.used  = true;
+            ++m_keys;
+        }
+
+        slot_ & slot = m_slots[ i ];
+
+        slot.items[ ( slot.front + slot.size ) % N ] = value;
+
+        if ( slot.size == N )
+        {
+            slot.front = static_cast<index_type>( ( slot.front + 1 ) % N );
+        }
+        else
+        {
+            ++slot.size;
+            ++m_elements;
+        }
+
+        link_front_( i );
+    }
+
+    void enforce_budget_()
+    {
+        while ( m_elements > m_budget )
+            erase_at_( m_tail );
+    }
+
+    // LRU list:
+
+    void link_front_( size_type i ) nsrs_noexcept
+    {
+        slot_ & slot = m_slots[ i ];
+
+        slot.prev = npos_;
+        slot.next = m_head;
+
+        if ( m_head != npos_ )
+            m_slots[ m_head ].prev = static_cast<index_type>( i );
+        else
+            m_tail = static_cast<index_type>( i );
+
+        m_head = static_cast<index_type>( i );
+    }
+
+    void unlink_( size_type i ) nsrs_noexcept
+    {
+        slot_ const & slot = m_slots[ i ];
+
+        if ( slot.prev != npos_ ) m_slots[ slot.prev ].next = slot.next;
+        else                      m_head = slot.next;
+
+        if ( slot.next != npos_ ) m_slots[ slot.next ].prev = slot.prev;
+        else                      m_tail = slot.prev;
+    }
+
+    // move the entry in slot from to the free slot to, keeping its list position:
+
+    void move_slot_( size_type from, size_type to )
+    {
+        slot_ & src = m_slots[ from ];
+        slot_ & dst = m_slots[ to   ];
+
+        dst.key   = std::move( src.key );
+        std::move( src.items, src.items + N, dst.items );
+        dst.hash  = src.hash;
+        dst.front = src.front;
+        dst.size  = src.size;
+        dst.prev  = src.prev;
+        dst.next  = src.next;
+        dst.used  = true;
+
+        index_type const at = static_cast<index_type>( to );
+
+        if ( dst.prev != npos_ ) m_slots[ dst.prev ].next = at;
+        else                     m_head = at;
+
+        if ( dst.next != npos_ ) m_slots[ dst.next ].prev = at;
+        else                     m_tail = at;
+    }
+
+    // remove the entry in slot i; shift back later entries of its probe run:
+
+    void erase_at_( size_type i )
+    {
+        unlink_( i );
+
+        m_elements -= m_slots[ i ].size;
+        --m_keys;
+
+        for ( size_type j = ( i + 1 ) & m_mask; m_slots[ j ].used; j = ( j + 1 ) & m_mask )
+        {
+            size_type const home = m_slots[ j ].hash & m_mask;
+
+            if ( ( ( j - home ) & m_mask ) >= ( ( j - i ) & m_mask ) )
+            {
+                move_slot_( j, i );
+                i = j;
+            }
+        }
+
+        release_( m_slots[ i ] );
+    }
+
+    // vacate slot, releasing resources held by its key and values:
+
+    static void release_( slot_ & slot )
+    {
+        slot.used = false;
+
+        if ( !std::is_trivially_destructible<Key>::value || !std::is_trivially_destructible<T>::value )
+        {
+            slot.key = Key();
+            std::fill( slot.items, slot.items + N, T() );
+        }
+    }
+
+private:
+    std::vector<slot_>  m_slots;
+    size_type           m_mask;
+    size_type           m_max_keys;
+    size_type           m_budget;
+    size_type           m_keys;
+    size_type           m_elements;
+    index_type          m_head;         // most recently touched
+    index_type          m_tail;         // least recently touched
+};
+
+template< class Key, class T, std::size_t N, class Hash, class KeyEqual >
+typename ring_map<Key, T, N, Hash, KeyEqual>::index_type const ring_map<Key, T, N, Hash, KeyEqual>::npos_;
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::ring_map;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_RING_MAP
+
+#endif // NONSTD_RING_MAP_LITE_HPP
@@ -0,0 +1,351 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RING_POOL_LITE_HPP
+#define NONSTD_RING_POOL_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Many small rings carved out of one slab, with a dense header table (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_RING_POOL  1
+#else
+# define nsrs_HAVE_RING_POOL  0
+#endif
+
+#if nsrs_HAVE_RING_POOL
+
+#include <cstdint>
+#include <vector>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// ring_pool: many small rings in one slab of elements, addressed by handle.
+//
+// A ring's capacity is rounded up to a power of 2, its size class. Blocks are
+// taken from the slab in order, and the block of a destroyed ring is kept for
+// the next ring of the same size class. The headers of all rings (offset,
+// capacity, front index and size) are stored column-wise, so visiting every
+// ring with for_each() is a linear scan. Like ring_span, push_back() on a
+// full ring overwrites its oldest element. A handle combines the index of
+// the ring's header with the header's generation, which destroy() bumps, so
+// a handle of a destroyed ring is no longer live() once its header is reused.
+//
+template< class T >
+class ring_pool
+{
+public:
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+    typedef std::uint64_t   handle_type;    // generation << 32 | header index
+    typedef std::uint32_t   index_type;
+
+    static handle_type const npos = ~handle_type( 0 );
+
+    // slab of slab_elements elements, headers for up to max_rings rings:
+
+    ring_pool( size_type slab_elements, size_type max_rings )
+        : m_slab( slab_elements )
+        , m_used( 0 )
+        , m_max_rings( max_rings )
+        , m_live( 0 )
+        , m_free_blocks( 33 )
+    {
+        assert( slab_elements <= ~index_type( 0 ) && max_rings < ~index_type( 0 ) );
+
+        m_offset    .reserve( max_rings );
+        m_capacity  .reserve( max_rings );
+        m_front     .reserve( max_rings );
+        m_size      .reserve( max_rings );
+        m_generation.reserve( max_rings );
+    }
+
+    ring_pool( ring_pool const & ) = delete;
+    ring_pool & operator=( ring_pool const & ) = delete;
+
+    // pool:
+
+    size_type rings() const nsrs_noexcept
+    {
+        return m_live;
+    }
+
+    size_type slab_size() const nsrs_noexcept
+    {
+        return m_slab.size();
+    }
+
+    // elements of the slab handed out as blocks so far:
+
+    size_type slab_used() const nsrs_noexcept
+    {
+        return m_used;
+    }
+
+    // new empty ring of at least the given capacity, npos if out of space:
+
+    handle_type create( size_type capacity )
+    {
+        assert( capacity <= ( size_type( 1 ) << 31 ) );
+
+        size_type klass = 0;
+        while ( ( size_type( 1 ) << klass ) < capacity )
+            ++klass;
+
+        index_type const block = index_type( 1 ) << klass;
+        index_type offset;
+
+        if ( ! m_free_blocks[ klass ].empty() )
+        {
+            offset = m_free_blocks[ klass ].back();
+        }
+        else if ( block <= m_slab.size() - m_used )
+        {
+            offset = static_cast<index_type>( m_used );
+        }
+        else
+        {
+            return npos;
+        }
+
+        index_type r;
+
+        if ( ! m_free_headers.empty() )
+        {
+            r = m_free_headers.back();
+            m_free_headers.pop_back();
+        }
+        else if ( m_offset.size() < m_max_rings )
+        {
+            r = static_cast<index_type>( m_offset.size() );
+            m_offset    .push_back( 0 );
+            m_capacity  .push_back( 0 );
+            m_front     .push_back( 0 );
+            m_size      .push_back( 0 );
+            m_generation.push_back( 0 );
+        }
+        else
+        {
+            return npos;
+        }
+
+        if ( ! m_free_blocks[ klass ].empty() )
+            m_free_blocks[ klass ].pop_back();
+        else
+            m_used += block;
+
+        m_offset  [ r ] = offset;
+        m_capacity[ r ] = block;
+        m_front   [ r ] = 0;
+        m_size    [ r ] = 0;
+        ++m_live;
+
+        return handle_( r );
+    }
+
+    // release the ring's elements and keep its block for reuse:
+
+    void destroy( handle_type h )
+    {
+        clear( h );
+
+        index_type const r = index_( h );
+
+        index_type klass = 0;
+        while ( ( index_type( 1 ) << klass ) < m_capacity[ r ] )
+            ++klass;
+
+        m_free_blocks[ klass ].push_back( m_offset[ r ] );
+        m_free_headers.push_back( r );
+        m_capacity[ r ] = 0;
+        ++m_generation[ r ];
+        --m_live;
+    }
+
+    bool live( handle_type h ) const nsrs_noexcept
+    {
+        size_type const r = static_cast<index_type>( h );
+
+        return r < m_capacity.size() && m_capacity[ r ] != 0 && m_generation[ r ] == ( h >> 32 );
+    }
+
+    // visit the handle of every live ring, in header order:
+
+    template< class F >
+    void for_each( F f )
+    {
+        for ( size_type r = 0; r < m_capacity.size(); ++r )
+        {
+            if ( m_capacity[ r ] != 0 )
+                f( handle_( static_cast<index_type>( r ) ) );
+        }
+    }
+
+    // ring observers:
+
+    bool empty( handle_type h ) const nsrs_noexcept
+    {
+        return m_size[ index_( h ) ] == 0;
+    }
+
+    bool full( handle_type h ) const nsrs_noexcept
+    {
+        index_type const r = index_( h );
+        return m_size[ r ] == m_capacity[ r ];
+    }
+
+    size_type size( handle_type h ) const nsrs_noexcept
+    {
+        return m_size[ index_( h ) ];
+    }
+
+    size_type capacity( handle_type h ) const nsrs_noexcept
+    {
+        return m_capacity[ index_( h ) ];
+    }
+
+    // ring element access:
+
+    T & at( handle_type h, size_type idx ) nsrs_noexcept
+    {
+        index_type const r = index_( h );
+        assert( idx < m_size[ r ] );
+        return slot_( r, m_front[ r ] + idx );
+    }
+
+    T const & at( handle_type h, size_type idx ) const nsrs_noexcept
+    {
+        index_type const r = index_( h );
+        assert( idx < m_size[ r ] );
+        return slot_( r, m_front[ r ] + idx );
+    }
+
+    T & front( handle_type h ) nsrs_noexcept
+    {
+        return at( h, 0 );
+    }
+
+    T & back( handle_type h ) nsrs_noexcept
+    {
+        return at( h, size( h ) - 1 );
+    }
+
+    // ring modifiers:
+
+    void push_back( handle_type h, T const & value )
+    {
+        next_slot_( index_( h ) ) = value;
+    }
+
+    void push_back( handle_type h, T && value )
+    {
+        next_slot_( index_( h ) ) = std::move( value );
+    }
+
+    T pop_front( handle_type h )
+    {
+        index_type const r = index_( h );
+        assert( m_size[ r ] != 0 );
+
+        T & element = slot_( r, m_front[ r ] );
+        m_front[ r ] = mask_( r, m_front[ r ] + 1u );
+        --m_size[ r ];
+
+        return std::move( element );
+    }
+
+    // remove all elements, see ring_span::clear():
+
+    void clear( handle_type h )
+    {
+        index_type const r = index_( h );
+
+        for ( index_type i = 0; i < m_size[ r ]; ++i )
+            slot_( r, m_front[ r ] + i ) = T();
+
+        m_front[ r ] = 0;
+        m_size [ r ] = 0;
+    }
+
+private:
+    handle_type handle_( index_type r ) const nsrs_noexcept
+    {
+        return ( handle_type( m_generation[ r ] ) << 32 ) | r;
+    }
+
+    // header index of a live ring:
+
+    index_type index_( handle_type h ) const nsrs_noexcept
+    {
+        assert( live( h ) );
+        return static_cast<index_type>( h );
+    }
+
+    index_type mask_( index_type r, size_type idx ) const nsrs_noexcept
+    {
+        return static_cast<index_type>( idx & ( m_capacity[ r ] - 1u ) );
+    }
+
+    T & slot_( index_type r, size_type idx ) nsrs_noexcept
+    {
+        return m_slab[ m_offset[ r ] + mask_( r, idx ) ];
+    }
+
+    T const & slot_( index_type r, size_type idx ) const nsrs_noexcept
+    {
+        return m_slab[ m_offset[ r ] + mask_( r, idx ) ];
+    }
+
+    // slot for a new back element; overwrites the front if full:
+
+    T & next_slot_( index_type r ) nsrs_noexcept
+    {
+        T & slot = slot_( r, size_type( m_front[ r ] ) + m_size[ r ] );
+
+        if ( m_size[ r ] == m_capacity[ r ] )
+            m_front[ r ] = mask_( r, m_front[ r ] + 1u );
+        else
+            ++m_size[ r ];
+
+        return slot;
+    }
+
+private:
+    std::vector<T>                          m_slab;
+    size_type                               m_used;
+    size_type                               m_max_rings;
+    size_type                               m_live;
+
+    // headers, column-wise:
+
+    std::vector<index_type>                 m_offset;
+    std::vector<index_type>                 m_capacity;     // 0: free handle
+    std::vector<index_type>                 m_front;
+    std::vector<index_type>                 m_size;
+    std::vector<index_type>                 m_generation;
+
+    std::vector< std::vector<index_type> >  m_free_blocks;  // offsets, per size class
+    std::vector<index_type>                 m_free_headers;
+};
+
+template< class T >
+typename ring_pool<T>::handle_type const ring_pool<T>::npos;
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::ring_pool;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_RING_POOL
+
+#endif // NONSTD_RING_POOL_LITE_HPP
@@ -0,0 +1,356 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RING_SHM_LITE_HPP
+#define NONSTD_RING_SHM_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Single-producer, single-consumer ring in POSIX shared memory (C++11, POSIX):
+
+#if nsrs_CPP11_OR_GREATER && ( defined(__unix__) || defined(__APPLE__) )
+# define nsrs_HAVE_SHM_RING  1
+#else
+# define nsrs_HAVE_SHM_RING  0
+#endif
+
+#if nsrs_HAVE_SHM_RING
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace nonstd { namespace ring_span_lite {
+
+namespace detail {
+
+// Header at the start of the shared memory object. It only contains
+// offsets and counters, never pointers, so that each process may map
+// the object at a different address.
+
+struct shm_ring_header
+{
+    std::atomic<std::uint64_t> magic;       // set last by creator (release)
+    std::uint64_t capacity;                 // in elements, power of 2
+    std::uint64_t element_size;             // sizeof(T) of creator
+    std::uint64_t data_offset;              // from start of header
+
+    alignas( nsrs_CONFIG_CACHELINE_SIZE ) std::atomic<std::uint64_t> head;  // next to read,  written by consumer
+    alignas( nsrs_CONFIG_CACHELINE_SIZE ) std::atomic<std::uint64_t> tail;  // next to write, written by producer
+};
+
+const std::uint64_t shm_ring_magic = 0x6e73727368726e67ULL;   // "nsrshrng"
+
+} // namespace detail
+
+//
+// shm_ring: lock-free SPSC ring of trivially copyable T in shared memory:
+//
+template< class T >
+class shm_ring
+{
+#if nsrs_CPP17_OR_GREATER
+    static_assert( std::atomic<std::uint64_t>::is_always_lock_free, "shm_ring requires address-free 64-bit atomics" );
+#endif
+    static_assert( std::is_trivially_copyable<T>::value, "shm_ring requires a trivially copyable element type" );
+
+public:
+    typedef T           value_type;
+    typedef std::size_t size_type;
+
+    shm_ring() nsrs_noexcept
+        : m_base( nsrs_nullptr )
+        , m_bytes( 0 )
+        , m_hdr( nsrs_nullptr )
+        , m_data( nsrs_nullptr )
+        , m_mask( 0 )
+        , m_head_cache( 0 )
+        , m_tail_cache( 0 )
+    {}
+
+    ~shm_ring()
+    {
+        detach();
+    }
+
+    shm_ring( shm_ring && other ) nsrs_noexcept
+        : shm_ring()
+    {
+        swap( other );
+    }
+
+    shm_ring & operator=( shm_ring && other ) nsrs_noexcept
+    {
+        detach(); swap( other ); return *this;
+    }
+
+    shm_ring( shm_ring const & ) = delete;
+    shm_ring & operator=( shm_ring const & ) = delete;
+
+    // number of bytes of the shared memory object for given capacity:
+
+    static size_type required_bytes( size_type capacity ) nsrs_noexcept
+    {
+        return data_offset() + capacity * sizeof(T);
+    }
+
+    // create and attach a new named shared memory object; returns 0 or errno:
+
+    int create( char const * name, size_type capacity )
+    {
+        int const fd = ::shm_open( name, O_CREAT | O_EXCL | O_RDWR, 0600 );
+
+        if ( fd < 0 )
+            return errno;
+
+        int const result = create( fd, capacity );
+
+        ::close( fd );
+
+        if ( result != 0 )
+            ::shm_unlink( name );
+
+        return result;
+    }
+
+    // attach to an existing named shared memory object; returns 0 or errno:
+
+    int attach( char const * name )
+    {
+        int const fd = ::shm_open( name, O_RDWR, 0600 );
+
+        if ( fd < 0 )
+            return errno;
+
+        int const result = attach( fd );
+
+        ::close( fd );
+        return result;
+    }
+
+    // create in given file, e.g. from memfd_create(); fd remains owned by caller:
+
+    int create( int fd, size_type capacity )
+    {
+        if ( !detail::is_power_of_2( capacity ) )
+            return EINVAL;
+
+        size_type const bytes = required_bytes( capacity );
+
+        if ( ::ftruncate( fd, static_cast< ::off_t >( bytes ) ) != 0 )
+            return errno;
+
+        int const result = map_( fd, bytes );
+
+        if ( result != 0 )
+            return result;
+
+        detail::shm_ring_header * hdr = new( m_base ) detail::shm_ring_header();
+
+        hdr->capacity     = capacity;
+        hdr->element_size = sizeof(T);
+        hdr->data_offset  = data_offset();
+        hdr->head.store( 0, std::memory_order_relaxed );
+        hdr->tail.store( 0, std::memory_order_relaxed );
+        hdr->magic.store( detail::shm_ring_magic, std::memory_order_release );
+
+        bind_( hdr );
+        return 0;
+    }
+
+    // attach to ring created in given file; fd remains owned by caller:
+
+    int attach( int fd )
+    {
+        struct ::stat st;
+
+        if ( ::fstat( fd, &st ) != 0 )
+            return errno;
+
+        size_type const bytes = static_cast<size_type>( st.st_size );
+
+        if ( bytes < data_offset() )
+            return EINVAL;
+
+        int const result = map_( fd, bytes );
+
+        if ( result != 0 )
+            return result;
+
+        detail::shm_ring_header * hdr = static_cast<detail::shm_ring_header *>( m_base );
+
+        if (   hdr->magic.load( std::memory_order_acquire ) != detail::shm_ring_magic
+            || hdr->element_size != sizeof(T)
+            || hdr->data_offset  != data_offset()
+            || !detail::is_power_of_2( hdr->capacity )
+            || bytes < required_bytes( static_cast<size_type>( hdr->capacity ) ) )
+        {
+            detach();
+            return EPROTO;
+        }
+
+        bind_( hdr );
+        return 0;
+    }
+
+    void detach() nsrs_noexcept
+    {
+        if ( m_base )
+            ::munmap( m_base, m_bytes );
+
+        m_base = nsrs_nullptr; m_bytes = 0; m_hdr = nsrs_nullptr; m_data = nsrs_nullptr;
+        m_mask = 0; m_head_cache = 0; m_tail_cache = 0;
+    }
+
+    static int unlink( char const * name ) nsrs_noexcept
+    {
+        return ::shm_unlink( name ) == 0 ? 0 : errno;
+    }
+
+    // observers:
+
+    bool valid() const nsrs_noexcept
+    {
+        return m_hdr != nsrs_nullptr;
+    }
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_hdr ? m_mask + 1 : 0;
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        std::uint64_t const head = m_hdr->head.load( std::memory_order_acquire );
+        std::uint64_t const tail = m_hdr->tail.load( std::memory_order_acquire );
+
+        return static_cast<size_type>( tail - head );
+    }
+
+    bool empty() const nsrs_noexcept
+    {
+        return size() == 0;
+    }
+
+    bool full() const nsrs_noexcept
+    {
+        return size() == capacity();
+    }
+
+    // producer side:
+
+    bool try_push( T const & value ) nsrs_noexcept
+    {
+        std::uint64_t const tail = m_hdr->tail.load( std::memory_order_relaxed );
+
+        if ( tail - m_head_cache > m_mask )
+        {
+            m_head_cache = m_hdr->head.load( std::memory_order_acquire );
+
+            if ( tail - m_head_cache > m_mask )
+                return false;
+        }
+
+        std::memcpy( static_cast<void *>( m_data + ( tail & m_mask ) ), &value, sizeof(T) );
+        m_hdr->tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    // consumer side:
+
+    bool try_pop( T & value ) nsrs_noexcept
+    {
+        std::uint64_t const head = m_hdr->head.load( std::memory_order_relaxed );
+
+        if ( head == m_tail_cache )
+        {
+            m_tail_cache = m_hdr->tail.load( std::memory_order_acquire );
+
+            if ( head == m_tail_cache )
+                return false;
+        }
+
+        std::memcpy( static_cast<void *>( &value ), m_data + ( head & m_mask ), sizeof(T) );
+        m_hdr->head.store( head + 1, std::memory_order_release );
+        return true;
+    }
+
+    void swap( shm_ring & other ) nsrs_noexcept
+    {
+        using std::swap;
+        swap( m_base      , other.m_base       );
+        swap( m_bytes     , other.m_bytes      );
+        swap( m_hdr       , other.m_hdr        );
+        swap( m_data      , other.m_data       );
+        swap( m_mask      , other.m_mask       );
+        swap( m_head_cache, other.m_head_cache );
+        swap( m_tail_cache, other.m_tail_cache );
+    }
+
+private:
+    static size_type data_offset() nsrs_noexcept
+    {
+        size_type const align = alignof(T) > nsrs_CONFIG_CACHELINE_SIZE ? alignof(T) : nsrs_CONFIG_CACHELINE_SIZE;
+
+        return ( sizeof(detail::shm_ring_header) + align - 1 ) / align * align;
+    }
+
+    int map_( int fd, size_type bytes )
+    {
+        detach();
+
+        void * base = ::mmap( nsrs_nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+
+        if ( base == MAP_FAILED )
+            return errno;
+
+        m_base  = base;
+        m_bytes = bytes;
+        return 0;
+    }
+
+    // derive process-local pointers from the position-independent header:
+
+    void bind_( detail::shm_ring_header * hdr ) nsrs_noexcept
+    {
+        m_hdr        = hdr;
+        m_data       = reinterpret_cast<T *>( static_cast<char *>( m_base ) + hdr->data_offset );
+        m_mask       = static_cast<size_type>( hdr->capacity - 1 );
+        m_head_cache = hdr->head.load( std::memory_order_acquire );
+        m_tail_cache = hdr->tail.load( std::memory_order_acquire );
+    }
+
+private:
+    void *                      m_base;
+    size_type                   m_bytes;
+    detail::shm_ring_header *   m_hdr;
+    T *                         m_data;
+    size_type                   m_mask;
+    std::uint64_t               m_head_cache;   // producer's view of head
+    std::uint64_t               m_tail_cache;   // consumer's view of tail
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::shm_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_SHM_RING
+
+#endif // NONSTD_RING_SHM_LITE_HPP
@@ -62,6 +62,12 @@
 # define nsrs_CONFIG_CONFIRMS_COMPILATION_ERRORS  0
 #endif
 
+// Size used to keep indices of concurrent rings on separate cache lines:
+
+#ifndef  nsrs_CONFIG_CACHELINE_SIZE
+# define nsrs_CONFIG_CACHELINE_SIZE  64
+#endif
+
 // C++ language version detection (C++23 is speculative):
 // Note: VC14.0/1900 (VS2015) lacks too much from C++14.
 
@@ -279,14 +285,15 @@ nsrs_DISABLE_MSVC_WARNINGS( 4345 26439 26440 26472 26473 26481 26490 )
 
 // includes:
 
+#include <algorithm>           // std::copy(), std::move(); std::swap() until C++11
 #include <cassert>
+#include <cstring>
 #include <iterator>
 #include <utility>
 
-// additional includes:
-
-#if ! nsrs_CPP11_OR_GREATER
-# include <algorithm>           // std::swap() until C++11
+#if nsrs_CPP11_OR_GREATER
+# include <memory>              // is_trivially_relocatable<std::unique_ptr<T>>
+# include <vector>              // is_trivially_relocatable<std::vector<T>>
 #endif
 
 namespace nonstd { namespace ring_span_lite {
@@ -387,6 +394,39 @@ struct is_nothrow_swappable : decltype( detail::is_nothrow_swappable::test<T>(0)
 
 } // namespace std17
 
+//
+// trivial relocation:
+//
+// A type is trivially relocatable if moving an object to a new address and
+// ending the life of the original is equivalent to copying its bytes. Ring
+// operations that move elements between slots, such as linearize() and
+// migrate_to(), then exchange bytes segment-wise instead of moving element by
+// element. Opt in by specializing is_trivially_relocatable in namespace
+// nonstd::ring_span_lite.
+//
+
+#if nsrs_CPP11_OR_GREATER
+
+template< class T >
+struct is_trivially_relocatable : std17::bool_constant< std::is_trivially_copyable<T>::value > {};
+
+template< class T >
+struct is_trivially_relocatable< std::unique_ptr<T> > : std11::true_type {};
+
+// the debug-mode std::vector of libstdc++ and MSVC keeps pointers to itself:
+
+#if !defined( _GLIBCXX_DEBUG ) && !( defined( _ITERATOR_DEBUG_LEVEL ) && _ITERATOR_DEBUG_LEVEL > 0 )
+template< class T >
+struct is_trivially_relocatable< std::vector<T> > : std11::true_type {};
+#endif
+
+#else
+
+template< class T >
+struct is_trivially_relocatable : std11::false_type {};
+
+#endif // nsrs_CPP11_OR_GREATER
+
 //
 // element extraction policies:
 //
@@ -453,6 +493,128 @@ bool is_power_of_2( T n )
     return n > 0 && (n & (n - 1)) == 0;
 }
 
+// trivially copyable elements already move as bytes:
+
+#if nsrs_CPP11_OR_GREATER
+template< typename T >
+struct relocate_bytewise : std17::bool_constant<
+    is_trivially_relocatable<T>::value && !std::is_trivially_copyable<T>::value > {};
+#else
+template< typename T >
+struct relocate_bytewise : std11::false_type {};
+#endif
+
+// exchange the bytes of [first, last) and the non-overlapping range at dest:
+
+inline void swap_bytes( unsigned char * first, unsigned char * last, unsigned char * dest ) nsrs_noexcept
+{
+    unsigned char block[ 512 ];
+
+    while ( first != last )
+    {
+        std::size_t const n = static_cast<std::size_t>( last - first ) < sizeof( block )
+            ? static_cast<std::size_t>( last - first ) : sizeof( block );
+
+        std::memcpy( block, dest , n );
+        std::memcpy( dest , first, n );
+        std::memcpy( first, block, n );
+
+        first += n;
+        dest  += n;
+    }
+}
+
+// move the elements of [first, last) onto the elements starting at dest;
+// trivially relocatable elements are exchanged bytewise, the source receiving
+// the former destination values:
+
+template< typename T >
+T * move_elements( T * first, T * last, T * dest, std11::false_type )
+{
+#if nsrs_CPP11_OR_GREATER
+    return std::move( first, last, dest );
+#else
+    return std::copy( first, last, dest );
+#endif
+}
+
+template< typename T >
+T * move_elements( T * first, T * last, T * dest, std11::true_type ) nsrs_noexcept
+{
+    swap_bytes( reinterpret_cast<unsigned char *>( first )
+              , reinterpret_cast<unsigned char *>( last  )
+              , reinterpret_cast<unsigned char *>( dest  ) );
+
+    return dest + ( last - first );
+}
+
+template< typename T >
+T * move_elements( T * first, T * last, T * dest )
+{
+    return move_elements( first, last, dest, relocate_bytewise<T>() );
+}
+
+// rotate [first, last) so that middle becomes the first element:
+
+template< typename T >
+void rotate_elements( T * first, T * middle, T * last, std11::false_type )
+{
+    std::rotate( first, middle, last );
+}
+
+// block-swap rotation: each step puts the shorter part in its final place,
+// until that part fits a small buffer and the rest is moved in one go:
+
+template< typename T >
+void rotate_elements( T * first, T * middle, T * last, std11::true_type ) nsrs_noexcept
+{
+    unsigned char block[ 512 ];
+
+    while ( first != middle && middle != last )
+    {
+        unsigned char * const f = reinterpret_cast<unsigned char *>( first  );
+        unsigned char * const m = reinterpret_cast<unsigned char *>( middle );
+        unsigned char * const l = reinterpret_cast<unsigned char *>( last   );
+
+        std::size_t const a = static_cast<std::size_t>( m - f );
+        std::size_t const b = static_cast<std::size_t>( l - m );
+
+        if ( a <= sizeof( block ) )
+        {
+            std::memcpy ( block, f, a );
+            std::memmove( f, m, b );
+            std::memcpy ( f + b, block, a );
+            return;
+        }
+        if ( b <= sizeof( block ) )
+        {
+            std::memcpy ( block, m, b );
+            std::memmove( f + b, f, a );
+            std::memcpy ( f, block, b );
+            return;
+        }
+
+        if ( a <= b )
+        {
+            swap_bytes( f, m, m );
+            T * const next = middle + ( middle - first );
+            first  = middle;
+            middle = next;
+        }
+        else
+        {
+            swap_bytes( m, l, f );
+            first += last - middle;
+        }
+    }
+}
+
+template< typename T >
+void rotate_elements( T * first, T * middle, T * last )
+{
+    rotate_elements( first, middle, last, relocate_bytewise<T>() );
+}
+
 } // namespace detail
 
 //
@@ -464,6 +626,7 @@ template
     , class Popper = default_popper<T>
 #if nsrs_RING_SPAN_LITE_EXTENSION
     , bool CapacityIsPowerOf2 = false
+    , class IndexType = std::size_t
 #endif
 >
 class ring_span
@@ -474,14 +637,17 @@ class ring_span
 public:
     typedef T   value_type;
     typedef T * pointer;
+    typedef T const * const_pointer;
     typedef T & reference;
     typedef T const & const_reference;
 
     typedef std::size_t size_type;
 
 #if nsrs_RING_SPAN_LITE_EXTENSION
-    typedef ring_span< T, Popper, CapacityIsPowerOf2 > type;
+    typedef IndexType   index_type;     // stores size, capacity and front index
+    typedef ring_span< T, Popper, CapacityIsPowerOf2, IndexType > type;
 #else
+    typedef std::size_t index_type;
     typedef ring_span< T, Popper > type;
 #endif
 
@@ -505,16 +671,17 @@ public:
     : Popper     ( std11::move( popper ) )
     , m_data     ( &* begin )
     , m_size     ( 0 )
-    , m_capacity ( static_cast<size_type>( end - begin ) )
+    , m_capacity ( static_cast<index_type>( end - begin ) )
     , m_front_idx( 0 )
 #else
     : m_data     ( &* begin )
     , m_size     ( 0 )
-    , m_capacity ( static_cast<size_type>( end - begin ) )
+    , m_capacity ( static_cast<index_type>( end - begin ) )
     , m_front_idx( 0 )
     , m_popper   ( std11::move( popper ) )
 #endif
     {
+        assert( static_cast<size_type>( end - begin ) == m_capacity );
 #if nsrs_RING_SPAN_LITE_EXTENSION
         assert( !CapacityIsPowerOf2 || detail::is_power_of_2( m_capacity ) );
 #endif
@@ -531,17 +698,18 @@ public:
 #if nsrs_CONFIG_POPPER_EMPTY_BASE_CLASS
     : Popper     ( std11::move( popper ) )
     , m_data     ( &* begin )
-    , m_size     ( size     )
-    , m_capacity ( static_cast<size_type>( end   - begin ) )
-    , m_front_idx( static_cast<size_type>( first - begin ) )
+    , m_size     ( static_cast<index_type>( size ) )
+    , m_capacity ( static_cast<index_type>( end   - begin ) )
+    , m_front_idx( static_cast<index_type>( first - begin ) )
 #else
     : m_data     ( &* begin )
-    , m_size     ( size     )
-    , m_capacity ( static_cast<size_type>( end   - begin ) )
-    , m_front_idx( static_cast<size_type>( first - begin ) )
+    , m_size     ( static_cast<index_type>( size ) )
+    , m_capacity ( static_cast<index_type>( end   - begin ) )
+    , m_front_idx( static_cast<index_type>( first - begin ) )
     , m_popper   ( std11::move( popper ) )
 #endif
     {
+        assert( static_cast<size_type>( end - begin ) == m_capacity );
         assert( m_size <= m_capacity );
 #if nsrs_RING_SPAN_LITE_EXTENSION
         assert( !CapacityIsPowerOf2 || detail::is_power_of_2( m_capacity ) );
@@ -796,6 +964,119 @@ public:
         front_() = T( std::forward<Args>(args)...);
     }
 #endif
+#endif // nsrs_RING_SPAN_LITE_EXTENSION
+
+#if nsrs_RING_SPAN_LITE_EXTENSION
+
+    // contiguous segments of elements, from front to back:
+
+    std::pair<pointer, size_type> array_one() nsrs_noexcept
+    {
+        return std::pair<pointer, size_type>( m_data + m_front_idx, size_one_() );
+    }
+
+    std::pair<pointer, size_type> array_two() nsrs_noexcept
+    {
+        return std::pair<pointer, size_type>( m_data, m_size - size_one_() );
+    }
+
+    std::pair<const_pointer, size_type> array_one() const nsrs_noexcept
+    {
+        return std::pair<const_pointer, size_type>( m_data + m_front_idx, size_one_() );
+    }
+
+    std::pair<const_pointer, size_type> array_two() const nsrs_noexcept
+    {
+        return std::pair<const_pointer, size_type>( m_data, m_size - size_one_() );
+    }
+
+    // contiguous segments of free slots, following the back:
+
+    std::pair<pointer, size_type> free_array_one() nsrs_noexcept
+    {
+        return std::pair<pointer, size_type>( m_data + free_idx_(), free_size_one_() );
+    }
+
+    std::pair<pointer, size_type> free_array_two() nsrs_noexcept
+    {
+        return std::pair<pointer, size_type>( m_data, size_type( m_capacity ) - m_size - free_size_one_() );
+    }
+
+    // append n elements written directly into the free segments:
+
+    void commit_back( size_type n ) nsrs_noexcept
+    {
+        assert( n <= capacity() - size() );
+        m_size = static_cast<index_type>( m_size + n );
+    }
+
+    // remove n elements from the front, bypassing the popper:
+
+    void consume_front( size_type n ) nsrs_noexcept
+    {
+        assert( n <= size() );
+        m_front_idx = static_cast<index_type>( m_capacity > 0 ? normalize_( m_front_idx + n ) : 0 );
+        m_size      = static_cast<index_type>( m_size - n );
+    }
+
+    // remove all elements, bypassing the popper; in O(1) for a trivially
+    // destructible type, otherwise each element is released by assigning T():
+
+    void clear()
+    {
+#if nsrs_CPP11_OR_GREATER
+        typedef std17::bool_constant< std::is_trivially_destructible<T>::value > is_trivial;
+#else
+        typedef std11::false_type is_trivial;
+#endif
+        release_( array_one(), is_trivial() );
+        release_( array_two(), is_trivial() );
+
+        m_size      = 0;
+        m_front_idx = 0;
+    }
+
+    // rotate the buffer so that the front is at its start; the elements then
+    // form a single segment:
+
+    pointer linearize()
+    {
+        if ( m_front_idx != 0 )
+        {
+            detail::rotate_elements( m_data, m_data + m_front_idx, m_data + m_capacity );
+            m_front_idx = 0;
+        }
+        return m_data;
+    }
+
+    // move the elements to the start of [begin, end), which must not overlap the
+    // current buffer, and continue on it; keeps the newest elements that fit:
+
+    template< class ContiguousIterator >
+    void migrate_to( ContiguousIterator begin, ContiguousIterator end )
+    {
+        pointer   const data     = &* begin;
+        size_type const capacity = static_cast<size_type>( end - begin );
+        size_type const size     = m_size < capacity ? size_type( m_size ) : capacity;
+
+        assert( !CapacityIsPowerOf2 || detail::is_power_of_2( capacity ) );
+
+        consume_front( m_size - size );
+
+        std::pair<pointer, size_type> const one = array_one();
+        std::pair<pointer, size_type> const two = array_two();
+
+        detail::move_elements( two.first, two.first + two.second,
+            detail::move_elements( one.first, one.first + one.second, data ) );
+
+        m_data      = data;
+        m_size      = static_cast<index_type>( size );
+        m_capacity  = static_cast<index_type>( capacity );
+        m_front_idx = 0;
+
+        assert( capacity == m_capacity );
+    }
+
 #endif // nsrs_RING_SPAN_LITE_EXTENSION
 
     // swap:
@@ -825,7 +1106,7 @@ private:
 
     size_type normalize_( size_type const idx, std11::true_type ) const nsrs_noexcept
     {
-        return idx & (m_capacity - 1);
+        return idx & ( size_type( m_capacity ) - 1 );
     }
 
     size_type normalize_( size_type const idx, std11::false_type ) const nsrs_noexcept
@@ -846,12 +1127,12 @@ private:
 
     reference at_( size_type idx ) nsrs_noexcept
     {
-        return m_data[ normalize_(m_front_idx + idx) ];
+        return m_data[ normalize_( m_front_idx + idx ) ];
     }
 
     const_reference at_( size_type idx ) const nsrs_noexcept
     {
-        return m_data[ normalize_(m_front_idx + idx) ];
+        return m_data[ normalize_( m_front_idx + idx ) ];
     }
 
     reference front_() nsrs_noexcept
@@ -866,23 +1147,23 @@ private:
 
     reference back_() nsrs_noexcept
     {
-        return *( m_data + normalize_(m_front_idx + m_size - 1) );
+        return *( m_data + normalize_( size_type( m_front_idx ) + m_size - 1 ) );
     }
 
     const_reference back_() const nsrs_noexcept
     {
-        return *( m_data + normalize_(m_front_idx + m_size - 1) );
+        return *( m_data + normalize_( size_type( m_front_idx ) + m_size - 1 ) );
     }
 
     void increment_front_() nsrs_noexcept
     {
-        m_front_idx = normalize_(m_front_idx + 1);
+        m_front_idx = static_cast<index_type>( normalize_( size_type( m_front_idx ) + 1 ) );
         --m_size;
     }
 
     void decrement_front_() nsrs_noexcept
     {
-        m_front_idx = normalize_(m_front_idx + m_capacity - 1);
+        m_front_idx = static_cast<index_type>( normalize_( size_type( m_front_idx ) + m_capacity - 1 ) );
         ++m_size;
     }
 
@@ -898,19 +1179,48 @@ private:
 
     void increment_front_and_back_() nsrs_noexcept
     {
-        m_front_idx = normalize_( m_front_idx + 1 );
+        m_front_idx = static_cast<index_type>( normalize_( size_type( m_front_idx ) + 1 ) );
     }
 
     void decrement_front_and_back_() nsrs_noexcept
     {
-        m_front_idx = normalize_( m_front_idx + m_capacity - 1 );
+        m_front_idx = static_cast<index_type>( normalize_( size_type( m_front_idx ) + m_capacity - 1 ) );
+    }
+
+#if nsrs_RING_SPAN_LITE_EXTENSION
+
+    size_type size_one_() const nsrs_noexcept
+    {
+        size_type const tail = size_type( m_capacity ) - m_front_idx;
+        return m_size < tail ? size_type( m_size ) : tail;
+    }
+
+    size_type free_idx_() const nsrs_noexcept
+    {
+        return m_capacity > 0 ? normalize_( size_type( m_front_idx ) + m_size ) : 0;
+    }
+
+    size_type free_size_one_() const nsrs_noexcept
+    {
+        size_type const free = size_type( m_capacity ) - m_size;
+        size_type const tail = size_type( m_capacity ) - free_idx_();
+        return free < tail ? free : tail;
     }
 
+    static void release_( std::pair<pointer, size_type>, std11::true_type ) nsrs_noexcept {}
+
+    static void release_( std::pair<pointer, size_type> segment, std11::false_type )
+    {
+        for ( pointer p = segment.first; p != segment.first + segment.second; ++p )
+            *p = T();
+    }
+#endif
+
 private:
-    pointer   m_data;
-    size_type m_size;
-    size_type m_capacity;
-    size_type m_front_idx;
+    pointer    m_data;
+    index_type m_size;
+    index_type m_capacity;
+    index_type m_front_idx;
 #if !nsrs_CONFIG_POPPER_EMPTY_BASE_CLASS
     nsrs_NO_UNIQUE_ADDRESS Popper m_popper;
 #endif
@@ -985,14 +1295,14 @@ public:
     // see issue #30:
 
 #if nsrs_RING_SPAN_LITE_EXTENSION
-    reference operator[]( size_type idx ) nsrs_noexcept
+    reference operator[]( difference_type n ) nsrs_noexcept
     {
-        return m_rs->at_(m_idx + idx);
+        return m_rs->at_( m_idx + static_cast<size_type>( n ) );
     }
 
-    const reference operator[]( size_type idx ) const nsrs_noexcept
+    const reference operator[]( difference_type n ) const nsrs_noexcept
     {
-        return m_rs->at_(m_idx + idx);
+        return m_rs->at_( m_idx + static_cast<size_type>( n ) );
     }
 #endif
 
@@ -1018,25 +1328,18 @@ public:
         type r(*this); --*this; return r;
     }
 
-#if defined(__clang__) || defined(__GNUC__)
-# pragma GCC diagnostic push
-# pragma GCC diagnostic ignored "-Wsign-conversion"
-#endif
+    // unsigned wrap-around makes a negative n step back:
 
-    type & operator+=( int i ) nsrs_noexcept
+    type & operator+=( difference_type n ) nsrs_noexcept
     {
-        m_idx += i; return *this;
+        m_idx += static_cast<size_type>( n ); return *this;
     }
 
-    type & operator-=( int i ) nsrs_noexcept
+    type & operator-=( difference_type n ) nsrs_noexcept
     {
-        m_idx -= i; return *this;
+        m_idx -= static_cast<size_type>( n ); return *this;
     }
 
-#if defined(__clang__) || defined(__GNUC__)
-# pragma GCC diagnostic pop
-#endif
-
 #if nsrs_RING_SPAN_LITE_EXTENSION
 
     template< bool C >
@@ -1104,21 +1407,21 @@ private:
 // advanced iterator:
 
 template< class RS, bool C >
-inline ring_iterator<RS,C> operator+( ring_iterator<RS,C> it, int i ) nsrs_noexcept
+inline ring_iterator<RS,C> operator+( ring_iterator<RS,C> it, typename ring_iterator<RS,C>::difference_type n ) nsrs_noexcept
 {
-    it += i; return it;
+    it += n; return it;
 }
 
 template< class RS, bool C >
-inline ring_iterator<RS,C> operator+(  int i, ring_iterator<RS,C> it ) nsrs_noexcept
+inline ring_iterator<RS,C> operator+( typename ring_iterator<RS,C>::difference_type n, ring_iterator<RS,C> it ) nsrs_noexcept
 {
-    it += i; return it;
+    it += n; return it;
 }
 
 template< class RS, bool C >
-inline ring_iterator<RS,C> operator-( ring_iterator<RS,C> it, int i ) nsrs_noexcept
+inline ring_iterator<RS,C> operator-( ring_iterator<RS,C> it, typename ring_iterator<RS,C>::difference_type n ) nsrs_noexcept
 {
-    it -= i; return it;
+    it -= n; return it;
 }
 
 } // namespace detail
@@ -1128,6 +1431,7 @@ using ring_span_lite::ring_span;
 using ring_span_lite::null_popper;
 using ring_span_lite::default_popper;
 using ring_span_lite::copy_popper;
+using ring_span_lite::is_trivially_relocatable;
 
 } // namespace nonstd
 
@@ -0,0 +1,196 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_RING_STREAMBUF_LITE_HPP
+#define NONSTD_RING_STREAMBUF_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Stream buffer that formats into and parses from a ring of characters (extension):
+
+#if nsrs_RING_SPAN_LITE_EXTENSION
+# define nsrs_HAVE_RING_STREAMBUF  1
+#else
+# define nsrs_HAVE_RING_STREAMBUF  0
+#endif
+
+#if nsrs_HAVE_RING_STREAMBUF
+
+#include <climits>
+#include <streambuf>
+#include <string>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// basic_ring_streambuf: std::basic_streambuf over the segments of a ring_span.
+//
+// The put area is the first contiguous free segment of the ring and the get
+// area is its first contiguous segment of elements, so that formatted output
+// is written into the ring and input is read from it, without intermediate
+// buffer. Characters written and read are committed to the ring on overflow,
+// underflow and pubsync(); call pubsync() before and after using the ring
+// directly. Output fails when the ring is full.
+//
+template< class RingSpan, class Traits = std::char_traits< typename RingSpan::value_type > >
+class basic_ring_streambuf : public std::basic_streambuf< typename RingSpan::value_type, Traits >
+{
+    typedef std::basic_streambuf< typename RingSpan::value_type, Traits > base;
+
+public:
+    typedef typename base::char_type    char_type;
+    typedef typename base::traits_type  traits_type;
+    typedef typename base::int_type     int_type;
+    typedef typename RingSpan::size_type size_type;
+
+    explicit basic_ring_streambuf( RingSpan & ring )
+        : m_ring( ring )
+    {
+        reset_areas_();
+    }
+
+    ~basic_ring_streambuf()
+    {
+        commit_();
+    }
+
+    RingSpan & ring() nsrs_noexcept
+    {
+        return m_ring;
+    }
+
+protected:
+    virtual int sync()
+    {
+        commit_();
+        reset_areas_();
+        return 0;
+    }
+
+    virtual std::streamsize showmanyc()
+    {
+        sync();
+        return static_cast<std::streamsize>( m_ring.size() );
+    }
+
+    virtual int_type overflow( int_type ch )
+    {
+        sync();
+
+        if ( traits_type::eq_int_type( ch, traits_type::eof() ) )
+            return traits_type::not_eof( ch );
+
+        if ( this->pptr() == this->epptr() )
+            return traits_type::eof();
+
+        *this->pptr() = traits_type::to_char_type( ch );
+        this->pbump( 1 );
+        return ch;
+    }
+
+    virtual std::streamsize xsputn( char_type const * s, std::streamsize n )
+    {
+        std::streamsize done = 0;
+
+        while ( done < n )
+        {
+            if ( this->pptr() == this->epptr() )
+            {
+                sync();
+
+                if ( this->pptr() == this->epptr() )
+                    break;
+            }
+
+            int const chunk = chunk_( n - done, this->epptr() - this->pptr() );
+
+            traits_type::copy( this->pptr(), s + done, static_cast<std::size_t>( chunk ) );
+            this->pbump( chunk );
+            done += chunk;
+        }
+        return done;
+    }
+
+    virtual int_type underflow()
+    {
+        sync();
+
+        if ( this->gptr() == this->egptr() )
+            return traits_type::eof();
+
+        return traits_type::to_int_type( *this->gptr() );
+    }
+
+    virtual std::streamsize xsgetn( char_type * s, std::streamsize n )
+    {
+        std::streamsize done = 0;
+
+        while ( done < n )
+        {
+            if ( this->gptr() == this->egptr() )
+            {
+                sync();
+
+                if ( this->gptr() == this->egptr() )
+                    break;
+            }
+
+            int const chunk = chunk_( n - done, this->egptr() - this->gptr() );
+
+            traits_type::copy( s + done, this->gptr(), static_cast<std::size_t>( chunk ) );
+            this->gbump( chunk );
+            done += chunk;
+        }
+        return done;
+    }
+
+private:
+    static int chunk_( std::streamsize wanted, std::ptrdiff_t available ) nsrs_noexcept
+    {
+        std::streamsize const n = wanted < available ? wanted : static_cast<std::streamsize>( available );
+        return n < INT_MAX ? static_cast<int>( n ) : INT_MAX;
+    }
+
+    // transfer characters written and read to the ring:
+
+    void commit_() nsrs_noexcept
+    {
+        m_ring.commit_back  ( static_cast<size_type>( this->pptr() - this->pbase() ) );
+        m_ring.consume_front( static_cast<size_type>( this->gptr() - this->eback() ) );
+
+        this->setp( this->pptr(), this->pptr() );
+        this->setg( this->gptr(), this->gptr(), this->gptr() );
+    }
+
+    void reset_areas_() nsrs_noexcept
+    {
+        std::pair<char_type *, size_type> const elems = m_ring.array_one();
+        std::pair<char_type *, size_type> const slots = m_ring.free_array_one();
+
+        this->setg( elems.first, elems.first, elems.first + elems.second );
+        this->setp( slots.first, slots.first + slots.second );
+    }
+
+private:
+    RingSpan & m_ring;
+};
+
+typedef basic_ring_streambuf< ring_span<char> > ring_streambuf;
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::basic_ring_streambuf;
+using ring_span_lite::ring_streambuf;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_RING_STREAMBUF
+
+#endif // NONSTD_RING_STREAMBUF_LITE_HPP
@@ -0,0 +1,196 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_SEQLOCK_RING_LITE_HPP
+#define NONSTD_SEQLOCK_RING_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Single-writer ring with seqlock-protected snapshots for any number of readers (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_SEQLOCK_RING  1
+#else
+# define nsrs_HAVE_SEQLOCK_RING  0
+#endif
+
+#if nsrs_HAVE_SEQLOCK_RING
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// seqlock_ring: one writer thread, snapshots of the whole ring for any thread.
+//
+// The writer makes the version odd before and even after each push_back() and
+// pop_front(), and never waits for a reader. snapshot() copies the (up to two)
+// segments of the ring, oldest first, and retries if the version was odd or
+// changed meanwhile, so the copy is never torn. Like ring_span, push_back() on
+// a full ring overwrites its oldest element.
+//
+template< class T >
+class seqlock_ring
+{
+    static_assert( std::is_trivially_copyable<T>::value,
+        "seqlock_ring requires a trivially copyable element type" );
+
+public:
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+    typedef std::uint64_t   version_type;
+
+    template< class ContiguousIterator >
+    seqlock_ring( ContiguousIterator begin, ContiguousIterator end )
+        : m_data    ( &* begin )
+        , m_capacity( static_cast<size_type>( end - begin ) )
+        , m_version ( 0 )
+        , m_front   ( 0 )
+        , m_size    ( 0 )
+    {
+        assert( m_capacity > 0 );
+    }
+
+    seqlock_ring( seqlock_ring const & ) = delete;
+    seqlock_ring & operator=( seqlock_ring const & ) = delete;
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_capacity;
+    }
+
+    // number of modifications so far, times 2; odd while one is in progress:
+
+    version_type version() const nsrs_noexcept
+    {
+        return m_version.load( std::memory_order_acquire );
+    }
+
+    // writer side:
+
+    bool empty() const nsrs_noexcept
+    {
+        return size() == 0;
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_size.load( std::memory_order_relaxed );
+    }
+
+    void push_back( T const & value ) nsrs_noexcept
+    {
+        size_type const front = m_front.load( std::memory_order_relaxed );
+        size_type const size  = m_size .load( std::memory_order_relaxed );
+
+        begin_write_();
+
+        std::memcpy( static_cast<void *>( m_data + wrap_( front + size ) ), &value, sizeof(T) );
+
+        if ( size == m_capacity )
+            m_front.store( wrap_( front + 1 ), std::memory_order_relaxed );
+        else
+            m_size .store( size + 1, std::memory_order_relaxed );
+
+        end_write_();
+    }
+
+    T pop_front() nsrs_noexcept
+    {
+        assert( ! empty() );
+
+        size_type const front = m_front.load( std::memory_order_relaxed );
+        T const result = m_data[ front ];
+
+        begin_write_();
+        m_front.store( wrap_( front + 1 ), std::memory_order_relaxed );
+        m_size .store( size() - 1, std::memory_order_relaxed );
+        end_write_();
+
+        return result;
+    }
+
+    // reader side: copy the elements, oldest first, to out[0..capacity()), return their number:
+
+    size_type snapshot( T * out ) const nsrs_noexcept
+    {
+        for ( ;; )
+        {
+            version_type const version = m_version.load( std::memory_order_acquire );
+
+            if ( version & 1 )
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            size_type const front = m_front.load( std::memory_order_relaxed );
+            size_type const size  = m_size .load( std::memory_order_relaxed );
+
+            // a torn front and size is caught below; keep the copy within bounds:
+
+            if ( front < m_capacity && size <= m_capacity )
+            {
+                size_type const one = ( std::min )( size, m_capacity - front );
+
+                std::memcpy( static_cast<void *>( out       ), m_data + front, one          * sizeof(T) );
+                std::memcpy( static_cast<void *>( out + one ), m_data        , ( size - one ) * sizeof(T) );
+            }
+
+            std::atomic_thread_fence( std::memory_order_acquire );
+
+            if ( m_version.load( std::memory_order_relaxed ) == version )
+                return size;
+        }
+    }
+
+private:
+    size_type wrap_( size_type idx ) const nsrs_noexcept
+    {
+        return idx < m_capacity ? idx : idx - m_capacity;
+    }
+
+    void begin_write_() nsrs_noexcept
+    {
+        m_version.store( m_version.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+    }
+
+    void end_write_() nsrs_noexcept
+    {
+        m_version.store( m_version.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+private:
+    T *                         m_data;
+    size_type                   m_capacity;
+    char                        m_pad0[ nsrs_CONFIG_CACHELINE_SIZE ];
+
+    // written by writer:
+
+    std::atomic<version_type>   m_version;
+    std::atomic<size_type>      m_front;
+    std::atomic<size_type>      m_size;
+    char                        m_pad1[ nsrs_CONFIG_CACHELINE_SIZE ];
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::seqlock_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_SEQLOCK_RING
+
+#endif // NONSTD_SEQLOCK_RING_LITE_HPP
@@ -0,0 +1,468 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_SERIES_RING_LITE_HPP
+#define NONSTD_SERIES_RING_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Compressed time-series ring, Gorilla encoding (C++11, extension):
+
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+# define nsrs_HAVE_SERIES_RING  1
+#else
+# define nsrs_HAVE_SERIES_RING  0
+#endif
+
+#if nsrs_HAVE_SERIES_RING
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace nonstd { namespace ring_span_lite {
+
+namespace detail {
+
+inline unsigned leading_zeros64( std::uint64_t x ) nsrs_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? static_cast<unsigned>( __builtin_clzll( x ) ) : 64u;
+#else
+    unsigned n = 0;
+    for ( std::uint64_t bit = std::uint64_t(1) << 63; bit && !( x & bit ); bit >>= 1 )
+        ++n;
+    return n;
+#endif
+}
+
+inline unsigned trailing_zeros64( std::uint64_t x ) nsrs_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? static_cast<unsigned>( __builtin_ctzll( x ) ) : 64u;
+#else
+    unsigned n = 0;
+    for ( std::uint64_t bit = 1; bit && !( x & bit ); bit <<= 1 )
+        ++n;
+    return n;
+#endif
+}
+
+inline std::uint64_t double_bits( double value ) nsrs_noexcept
+{
+    std::uint64_t bits; std::memcpy( &bits, &value, sizeof bits ); return bits;
+}
+
+inline double bits_double( std::uint64_t bits ) nsrs_noexcept
+{
+    double value; std::memcpy( &value, &bits, sizeof value ); return value;
+}
+
+// One compressed block: a most-significant-bit-first bit stream of samples,
+// and the state needed to append to it.
+
+struct series_block
+{
+    std::vector<std::uint64_t>  words;
+    std::size_t                 bits;
+    std::size_t                 count;
+    std::int64_t                last_timestamp;
+    std::int64_t                last_delta;
+    std::uint64_t               last_value;
+    unsigned                    leading;        // window of the last stored XOR, 64: none
+    unsigned                    trailing;
+
+    series_block()
+    {
+        reset();
+    }
+
+    void reset() nsrs_noexcept
+    {
+        words.clear();      // keeps capacity
+        bits = count = 0;
+        last_timestamp = last_delta = 0;
+        last_value = 0;
+        leading = 64; trailing = 0;
+    }
+
+    // append the low n bits of value, 1 <= n <= 64:
+
+    void write( std::uint64_t value, unsigned n )
+    {
+        if ( n < 64 )
+            value &= ( std::uint64_t(1) << n ) - 1;
+
+        std::size_t const word = bits / 64;
+        unsigned    const room = 64 - static_cast<unsigned>( bits % 64 );
+
+        if ( word == words.size() )
+            words.push_back( 0 );
+
+        if ( n <= room )
+        {
+            words[word] |= value << ( room - n );
+        }
+        else
+        {
+            words[word] |= value >> ( n - room );
+            words.push_back( value << ( 64 - ( n - room ) ) );
+        }
+        bits += n;
+    }
+
+    // read n bits at given bit position, 1 <= n <= 64:
+
+    std::uint64_t read( std::size_t pos, unsigned n ) const nsrs_noexcept
+    {
+        std::size_t const word = pos / 64;
+        unsigned    const room = 64 - static_cast<unsigned>( pos % 64 );
+
+        std::uint64_t const head = room == 64 ? words[word] : words[word] & ( ( std::uint64_t(1) << room ) - 1 );
+
+        if ( n <= room )
+            return head >> ( room - n );
+
+        return ( head << ( n - room ) ) | ( words[word + 1] >> ( 64 - ( n - room ) ) );
+    }
+
+    void append( std::int64_t timestamp, double value )
+    {
+        std::uint64_t const vbits = double_bits( value );
+
+        if ( count++ == 0 )
+        {
+            write( static_cast<std::uint64_t>( timestamp ), 64 );
+            write( vbits, 64 );
+            last_timestamp = timestamp;
+            last_value     = vbits;
+            return;
+        }
+
+        // timestamp: delta-of-delta in a variable-length bucket:
+
+        std::int64_t const delta = timestamp - last_timestamp;
+        std::int64_t const dod   = delta - last_delta;
+
+        if      ( dod == 0 )                     { write( 0x0, 1 ); }
+        else if ( dod >=   -63 && dod <=   64 )  { write( 0x2, 2 ); write( static_cast<std::uint64_t>( dod +   63 ),  7 ); }
+        else if ( dod >=  -255 && dod <=  256 )  { write( 0x6, 3 ); write( static_cast<std::uint64_t>( dod +  255 ),  9 ); }
+        else if ( dod >= -2047 && dod <= 2048 )  { write( 0xe, 4 ); write( static_cast<std::uint64_t>( dod + 2047 ), 12 ); }
+        else                                     { write( 0xf, 4 ); write( static_cast<std::uint64_t>( dod ), 64 ); }
+
+        last_timestamp = timestamp;
+        last_delta     = delta;
+
+        // value: XOR with the previous value, meaningful bits only:
+
+        std::uint64_t const x = vbits ^ last_value;
+        last_value = vbits;
+
+        if ( x == 0 )
+        {
+            write( 0x0, 1 );
+            return;
+        }
+
+        unsigned const lead  = leading_zeros64( x );
+        unsigned const trail = trailing_zeros64( x );
+
+        if ( leading < 64 && lead >= leading && trail >= trailing )
+        {
+            write( 0x2, 2 );
+            write( x >> trailing, 64 - leading - trailing );
+        }
+        else
+        {
+            unsigned const length = 64 - lead - trail;
+
+            write( 0x3, 2 );
+            write( lead, 6 );
+            write( length - 1, 6 );
+            write( x >> trail, length );
+
+            leading  = lead;
+            trailing = trail;
+        }
+    }
+};
+
+// Decoding state for one block.
+
+struct series_decoder
+{
+    std::size_t     pos;
+    std::int64_t    timestamp;
+    std::int64_t    delta;
+    std::uint64_t   value;
+    unsigned        leading;
+    unsigned        trailing;
+
+    series_decoder() nsrs_noexcept
+        : pos( 0 ), timestamp( 0 ), delta( 0 ), value( 0 ), leading( 0 ), trailing( 0 )
+    {}
+
+    // decode sample number idx, having decoded the samples before it:
+
+    void next( series_block const & b, std::size_t idx ) nsrs_noexcept
+    {
+        if ( idx == 0 )
+        {
+            timestamp = static_cast<std::int64_t>( b.read( 0, 64 ) );
+            value     = b.read( 64, 64 );
+            pos       = 128;
+            delta     = 0;
+            return;
+        }
+
+        std::int64_t dod = 0;
+
+        if      ( !bit_( b ) ) { dod = 0; }
+        else if ( !bit_( b ) ) { dod = bits_( b,  7 ) -   63; }
+        else if ( !bit_( b ) ) { dod = bits_( b,  9 ) -  255; }
+        else if ( !bit_( b ) ) { dod = bits_( b, 12 ) - 2047; }
+        else                   { dod = static_cast<std::int64_t>( b.read( pos, 64 ) ); pos += 64; }
+
+        delta     += dod;
+        timestamp += delta;
+
+        if ( !bit_( b ) )
+            return;
+
+        if ( bit_( b ) )
+        {
+            leading  = static_cast<unsigned>( bits_( b, 6 ) );
+            trailing = 64 - leading - static_cast<unsigned>( bits_( b, 6 ) + 1 );
+        }
+
+        unsigned const length = 64 - leading - trailing;
+
+        value ^= b.read( pos, length ) << trailing;
+        pos   += length;
+    }
+
+private:
+    bool bit_( series_block const & b ) nsrs_noexcept
+    {
+        return b.read( pos++, 1 ) != 0;
+    }
+
+    std::int64_t bits_( series_block const & b, unsigned n ) nsrs_noexcept
+    {
+        std::int64_t const result = static_cast<std::int64_t>( b.read( pos, n ) );
+        pos += n;
+        return result;
+    }
+};
+
+} // namespace detail
+
+//
+// series_ring: ring of (timestamp, value) samples, compressed per block.
+//
+// Samples are appended to the newest block with Gorilla encoding: timestamps
+// as delta-of-delta in variable-length buckets, values as the meaningful bits
+// of their XOR with the previous value. When all blocks are in use, starting a
+// new block evicts the oldest block as a whole. Block slots are kept in a
+// ring_span and their buffers are reused. Iteration decodes block by block.
+//
+class series_ring
+{
+public:
+    typedef std::size_t                         size_type;
+    typedef std::pair< std::int64_t, double >   value_type;
+
+    class const_iterator;
+
+    explicit series_ring( size_type max_blocks, size_type block_samples = 120 )
+        : m_storage( max_blocks )
+        , m_blocks( m_storage.begin(), m_storage.end() )
+        , m_block_samples( block_samples )
+        , m_size( 0 )
+    {
+        assert( max_blocks > 0 && block_samples > 0 );
+    }
+
+    series_ring( series_ring const & ) = delete;
+    series_ring & operator=( series_ring const & ) = delete;
+
+    // observers:
+
+    bool empty() const nsrs_noexcept
+    {
+        return m_size == 0;
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_size;
+    }
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_blocks.capacity() * m_block_samples;
+    }
+
+    size_type blocks() const nsrs_noexcept
+    {
+        return m_blocks.size();
+    }
+
+    size_type block_samples() const nsrs_noexcept
+    {
+        return m_block_samples;
+    }
+
+    // bytes of compressed samples held:
+
+    size_type compressed_bytes() const nsrs_noexcept
+    {
+        size_type bits = 0;
+        for ( size_type i = 0; i < m_blocks.size(); ++i )
+            bits += m_blocks[i].bits;
+        return ( bits + 7 ) / 8;
+    }
+
+    // modifiers:
+
+    void push_back( std::int64_t timestamp, double value )
+    {
+        if ( m_blocks.empty() || m_blocks.back().count == m_block_samples )
+        {
+            if ( m_blocks.full() )
+            {
+                m_size -= m_blocks.front().count;
+                m_blocks.consume_front( 1 );
+            }
+
+            m_blocks.commit_back( 1 );
+            m_blocks.back().reset();
+        }
+
+        m_blocks.back().append( timestamp, value );
+        ++m_size;
+    }
+
+    void clear() nsrs_noexcept
+    {
+        m_blocks.consume_front( m_blocks.size() );
+        m_size = 0;
+    }
+
+    // decoding iteration, oldest first:
+
+    const_iterator begin() const
+    {
+        return const_iterator( this, 0 );
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator( this, m_blocks.size() );
+    }
+
+    // the decoded sample lives in the iterator, so it is an input iterator:
+
+    class const_iterator
+    {
+    public:
+        typedef std::input_iterator_tag     iterator_category;
+        typedef series_ring::value_type     value_type;
+        typedef std::ptrdiff_t              difference_type;
+        typedef value_type const *          pointer;
+        typedef value_type const &          reference;
+
+        const_iterator() nsrs_noexcept
+            : m_ring( nsrs_nullptr ), m_block( 0 ), m_sample( 0 )
+        {}
+
+        reference operator*() const nsrs_noexcept
+        {
+            return m_current;
+        }
+
+        pointer operator->() const nsrs_noexcept
+        {
+            return &m_current;
+        }
+
+        const_iterator & operator++() nsrs_noexcept
+        {
+            if ( ++m_sample == m_ring->m_blocks[m_block].count )
+            {
+                ++m_block;
+                m_sample = 0;
+            }
+            decode_();
+            return *this;
+        }
+
+        const_iterator operator++( int ) nsrs_noexcept
+        {
+            const_iterator result( *this );
+            ++*this;
+            return result;
+        }
+
+        friend bool operator==( const_iterator const & a, const_iterator const & b ) nsrs_noexcept
+        {
+            return a.m_block == b.m_block && a.m_sample == b.m_sample;
+        }
+
+        friend bool operator!=( const_iterator const & a, const_iterator const & b ) nsrs_noexcept
+        {
+            return !( a == b );
+        }
+
+    private:
+        friend class series_ring;
+
+        const_iterator( series_ring const * ring, size_type block ) nsrs_noexcept
+            : m_ring( ring ), m_block( block ), m_sample( 0 )
+        {
+            decode_();
+        }
+
+        void decode_() nsrs_noexcept
+        {
+            if ( m_block == m_ring->m_blocks.size() )
+                return;
+
+            m_decoder.next( m_ring->m_blocks[m_block], m_sample );
+            m_current.first  = m_decoder.timestamp;
+            m_current.second = detail::bits_double( m_decoder.value );
+        }
+
+    private:
+        series_ring const *     m_ring;
+        size_type               m_block;
+        size_type               m_sample;
+        detail::series_decoder  m_decoder;
+        value_type              m_current;
+    };
+
+private:
+    std::vector<detail::series_block>   m_storage;
+    ring_span<detail::series_block>     m_blocks;
+    size_type                           m_block_samples;
+    size_type                           m_size;
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::series_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_SERIES_RING
+
+#endif // NONSTD_SERIES_RING_LITE_HPP
@@ -0,0 +1,247 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_SOA_RING_LITE_HPP
+#define NONSTD_SOA_RING_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Struct-of-arrays ring: columns in separate buffers, one index set (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_SOA_RING  1
+#else
+# define nsrs_HAVE_SOA_RING  0
+#endif
+
+#if nsrs_HAVE_SOA_RING
+
+#include <tuple>
+#include <utility>
+
+namespace nonstd { namespace ring_span_lite {
+
+namespace detail {
+
+// C++11 replacement for std::index_sequence:
+
+template< std::size_t... Is >
+struct index_list {};
+
+template< std::size_t N, std::size_t... Is >
+struct make_index_list : make_index_list< N - 1, N - 1, Is... > {};
+
+template< std::size_t... Is >
+struct make_index_list< 0, Is... >
+{
+    typedef index_list< Is... > type;
+};
+
+} // namespace detail
+
+//
+// soa_ring: a ring of records {Ts...} stored as one contiguous array per column.
+//
+// A single front index and size drive all columns, so that push_back() computes
+// the slot once and stores each field there. A scan of one field reads only its
+// column; array_one<I>() and array_two<I>() give the (at most) two contiguous
+// segments of column I, oldest first. Like ring_span, push_back() on a full
+// ring overwrites the oldest record.
+//
+template< class... Ts >
+class soa_ring
+{
+    typedef typename detail::make_index_list< sizeof...(Ts) >::type indices;
+
+public:
+    typedef std::size_t             size_type;
+    typedef std::tuple< Ts &... >       reference;
+    typedef std::tuple< Ts const &... > const_reference;
+    typedef std::tuple< Ts... >         value_type;
+
+    template< std::size_t I >
+    using column_type = typename std::tuple_element< I, value_type >::type;
+
+    // empty ring over the given column buffers, each of capacity elements:
+
+    soa_ring( size_type capacity, Ts *... columns ) nsrs_noexcept
+        : m_columns  ( columns... )
+        , m_size     ( 0 )
+        , m_capacity ( capacity )
+        , m_front_idx( 0 )
+    {}
+
+    // observers:
+
+    bool empty() const nsrs_noexcept
+    {
+        return m_size == 0;
+    }
+
+    bool full() const nsrs_noexcept
+    {
+        return m_size == m_capacity;
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_size;
+    }
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_capacity;
+    }
+
+    static nsrs_constexpr size_type columns() nsrs_noexcept
+    {
+        return sizeof...(Ts);
+    }
+
+    // element access, idx counted from the front:
+
+    template< std::size_t I >
+    column_type<I> & get( size_type idx ) nsrs_noexcept
+    {
+        return std::get<I>( m_columns )[ normalize_( m_front_idx + idx ) ];
+    }
+
+    template< std::size_t I >
+    column_type<I> const & get( size_type idx ) const nsrs_noexcept
+    {
+        return std::get<I>( m_columns )[ normalize_( m_front_idx + idx ) ];
+    }
+
+    reference operator[]( size_type idx ) nsrs_noexcept
+    {
+        return record_<reference>( normalize_( m_front_idx + idx ), indices() );
+    }
+
+    const_reference operator[]( size_type idx ) const nsrs_noexcept
+    {
+        return record_<const_reference>( normalize_( m_front_idx + idx ), indices() );
+    }
+
+    reference front() nsrs_noexcept
+    {
+        return record_<reference>( m_front_idx, indices() );
+    }
+
+    const_reference front() const nsrs_noexcept
+    {
+        return record_<const_reference>( m_front_idx, indices() );
+    }
+
+    reference back() nsrs_noexcept
+    {
+        return record_<reference>( normalize_( m_front_idx + m_size - 1 ), indices() );
+    }
+
+    const_reference back() const nsrs_noexcept
+    {
+        return record_<const_reference>( normalize_( m_front_idx + m_size - 1 ), indices() );
+    }
+
+    // per-column segments: the oldest records, and the remainder after wrap-around:
+
+    template< std::size_t I >
+    std::pair< column_type<I> *, size_type > array_one() nsrs_noexcept
+    {
+        return std::make_pair( std::get<I>( m_columns ) + m_front_idx, size_one_() );
+    }
+
+    template< std::size_t I >
+    std::pair< column_type<I> const *, size_type > array_one() const nsrs_noexcept
+    {
+        return std::pair< column_type<I> const *, size_type >( std::get<I>( m_columns ) + m_front_idx, size_one_() );
+    }
+
+    template< std::size_t I >
+    std::pair< column_type<I> *, size_type > array_two() nsrs_noexcept
+    {
+        return std::make_pair( std::get<I>( m_columns ), m_size - size_one_() );
+    }
+
+    template< std::size_t I >
+    std::pair< column_type<I> const *, size_type > array_two() const nsrs_noexcept
+    {
+        return std::pair< column_type<I> const *, size_type >( std::get<I>( m_columns ), m_size - size_one_() );
+    }
+
+    // modifiers:
+
+    void push_back( Ts const &... values )
+    {
+        size_type const idx = normalize_( m_front_idx + m_size );
+
+        if ( full() ) m_front_idx = normalize_( m_front_idx + 1 );
+        else          ++m_size;
+
+        assign_( idx, indices(), values... );
+    }
+
+    void pop_front() nsrs_noexcept
+    {
+        assert( ! empty() );
+
+        m_front_idx = normalize_( m_front_idx + 1 );
+        --m_size;
+    }
+
+    void clear() nsrs_noexcept
+    {
+        m_size = 0;
+        m_front_idx = 0;
+    }
+
+private:
+    // idx < 2 * capacity: wrap without division:
+
+    size_type normalize_( size_type idx ) const nsrs_noexcept
+    {
+        return idx >= m_capacity ? idx - m_capacity : idx;
+    }
+
+    size_type size_one_() const nsrs_noexcept
+    {
+        return m_size < m_capacity - m_front_idx ? m_size : m_capacity - m_front_idx;
+    }
+
+    // reference or const_reference to the fields of the record in slot idx:
+
+    template< class Reference, std::size_t... Is >
+    Reference record_( size_type idx, detail::index_list< Is... > ) const nsrs_noexcept
+    {
+        return Reference( std::get<Is>( m_columns )[ idx ]... );
+    }
+
+    template< std::size_t... Is >
+    void assign_( size_type idx, detail::index_list< Is... >, Ts const &... values )
+    {
+        int expand[] = { 0, ( std::get<Is>( m_columns )[ idx ] = values, 0 )... };
+        (void) expand;
+    }
+
+private:
+    std::tuple< Ts *... >   m_columns;
+    size_type               m_size;
+    size_type               m_capacity;
+    size_type               m_front_idx;
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::soa_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_SOA_RING
+
+#endif // NONSTD_SOA_RING_LITE_HPP
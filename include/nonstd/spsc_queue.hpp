@@ -0,0 +1,225 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_SPSC_QUEUE_LITE_HPP
+#define NONSTD_SPSC_QUEUE_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Unbounded single-producer, single-consumer queue of linked segments (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_SPSC_QUEUE  1
+#else
+# define nsrs_HAVE_SPSC_QUEUE  0
+#endif
+
+#if nsrs_HAVE_SPSC_QUEUE
+
+#include <atomic>
+#include <utility>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// spsc_queue: unbounded queue for one producer and one consumer thread.
+//
+// Elements are stored in fixed-size segments that form a linked list from the
+// consumer to the producer. push() never fails or overwrites: when the last
+// segment is full, the producer links a new one. Segments the consumer has
+// drained are reused by the producer; at most MaxFree of them are kept, the
+// rest are deleted. Within a segment, push() and try_pop() cost the same as
+// on a bounded ring: one store of the own index, and a load of the other
+// index only when the locally cached copy is exhausted.
+//
+template< class T, std::size_t SegmentSize = 1024, std::size_t MaxFree = 4 >
+class spsc_queue
+{
+public:
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+
+    spsc_queue()
+        : m_tail      ( new segment_() )
+        , m_tail_write( 0 )
+        , m_first     ( m_tail )
+        , m_segments  ( 1 )
+        , m_reclaimed ( 0 )
+        , m_head      ( m_tail )
+        , m_head_write( 0 )
+        , m_passed    ( 0 )
+    {}
+
+    ~spsc_queue()
+    {
+        while ( m_first )
+        {
+            segment_ * const next = m_first->next.load( std::memory_order_relaxed );
+            delete m_first;
+            m_first = next;
+        }
+    }
+
+    spsc_queue( spsc_queue const & ) = delete;
+    spsc_queue & operator=( spsc_queue const & ) = delete;
+
+    // producer side:
+
+    void push( T const & value )
+    {
+        slot_() = value;
+        publish_();
+    }
+
+    void push( T && value )
+    {
+        slot_() = std::move( value );
+        publish_();
+    }
+
+    // number of segments allocated, including drained segments kept for reuse:
+
+    size_type segments() const nsrs_noexcept
+    {
+        return m_segments;
+    }
+
+    // consumer side:
+
+    bool try_pop( T & value )
+    {
+        if ( m_head->read == m_head_write && !refresh_() )
+            return false;
+
+        value = std::move( m_head->data[ m_head->read++ ] );
+        return true;
+    }
+
+    bool empty()
+    {
+        return m_head->read == m_head_write && !refresh_();
+    }
+
+private:
+    struct segment_
+    {
+        segment_()
+            : write( 0 ), read( 0 ), next( nsrs_nullptr )
+        {}
+
+        T                           data[ SegmentSize ];
+        std::atomic<size_type>      write;      // written by producer
+        size_type                   read;       // consumer only, while in use
+        std::atomic<segment_ *>     next;       // written by producer
+    };
+
+    // producer: next free slot, linking a segment if the last one is full:
+
+    T & slot_()
+    {
+        if ( m_tail_write == SegmentSize )
+        {
+            segment_ * const seg = acquire_segment_();
+
+            m_tail->next.store( seg, std::memory_order_release );
+            m_tail       = seg;
+            m_tail_write = 0;
+        }
+        return m_tail->data[ m_tail_write ];
+    }
+
+    void publish_() nsrs_noexcept
+    {
+        m_tail->write.store( ++m_tail_write, std::memory_order_release );
+    }
+
+    // producer: reuse a drained segment, trimming surplus ones, or allocate one:
+
+    segment_ * acquire_segment_()
+    {
+        size_type const passed = m_passed.load( std::memory_order_acquire );
+
+        while ( passed - m_reclaimed > MaxFree + 1 )
+        {
+            segment_ * const seg = m_first;
+            m_first = seg->next.load( std::memory_order_relaxed );
+            delete seg;
+            --m_segments;
+            ++m_reclaimed;
+        }
+
+        if ( passed - m_reclaimed > 0 )
+        {
+            segment_ * const seg = m_first;
+            m_first = seg->next.load( std::memory_order_relaxed );
+            ++m_reclaimed;
+
+            seg->write.store( 0, std::memory_order_relaxed );
+            seg->read = 0;
+            seg->next.store( nsrs_nullptr, std::memory_order_relaxed );
+            return seg;
+        }
+
+        ++m_segments;
+        return new segment_();
+    }
+
+    // consumer: reload the write index, moving on to the next segment when drained:
+
+    bool refresh_()
+    {
+        m_head_write = m_head->write.load( std::memory_order_acquire );
+
+        if ( m_head->read < m_head_write )
+            return true;
+
+        if ( m_head->read < SegmentSize )
+            return false;
+
+        segment_ * const next = m_head->next.load( std::memory_order_acquire );
+
+        if ( !next )
+            return false;
+
+        m_head       = next;
+        m_head_write = next->write.load( std::memory_order_acquire );
+        m_passed.store( m_passed.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+
+        return m_head->read < m_head_write;
+    }
+
+private:
+    // producer:
+
+    segment_ *              m_tail;
+    size_type               m_tail_write;   // cached m_tail->write
+    segment_ *              m_first;        // oldest segment, drained if passed
+    size_type               m_segments;
+    size_type               m_reclaimed;    // drained segments reused or deleted
+    char                    m_pad0[ nsrs_CONFIG_CACHELINE_SIZE ];
+
+    // consumer:
+
+    segment_ *              m_head;
+    size_type               m_head_write;   // cached m_head->write
+    char                    m_pad1[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<size_type>  m_passed;       // segments drained and left behind
+    char                    m_pad2[ nsrs_CONFIG_CACHELINE_SIZE ];
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::spsc_queue;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_SPSC_QUEUE
+
+#endif // NONSTD_SPSC_QUEUE_LITE_HPP
@@ -0,0 +1,188 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_STRING_RING_LITE_HPP
+#define NONSTD_STRING_RING_LITE_HPP
+
+#include <nonstd/record_ring.hpp>
+
+// Ring of strings: small strings inline, longer ones in a FIFO byte arena (C++17, extension):
+
+#if nsrs_HAVE_RECORD_RING && nsrs_CPP17_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+# define nsrs_HAVE_STRING_RING  1
+#else
+# define nsrs_HAVE_STRING_RING  0
+#endif
+
+#if nsrs_HAVE_STRING_RING
+
+#include <string_view>
+#include <vector>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// basic_string_ring: ring of strings that does not allocate after construction.
+//
+// Each string occupies a fixed-size slot. A string of up to InlineSize
+// characters is stored in its slot; a longer one is stored in a byte arena,
+// a record_ring, which is released in FIFO order as strings leave the ring.
+// Like ring_span, push_back() on a full ring overwrites the oldest string; it
+// also drops the oldest strings as long as the arena has no room.
+//
+template< std::size_t InlineSize = 48 >
+class basic_string_ring
+{
+public:
+    typedef std::size_t         size_type;
+    typedef std::string_view    value_type;
+
+    basic_string_ring( size_type capacity, size_type arena_bytes )
+        : m_slot_storage( capacity )
+        , m_slots( m_slot_storage.data(), m_slot_storage.data() + m_slot_storage.size() )
+        , m_arena_storage( arena_bytes )
+        , m_arena( m_arena_storage.data(), m_arena_storage.data() + m_arena_storage.size() )
+    {}
+
+    basic_string_ring( basic_string_ring const & ) = delete;
+    basic_string_ring & operator=( basic_string_ring const & ) = delete;
+
+    // observers:
+
+    bool empty() const nsrs_noexcept
+    {
+        return m_slots.empty();
+    }
+
+    bool full() const nsrs_noexcept
+    {
+        return m_slots.full();
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        return m_slots.size();
+    }
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return m_slots.capacity();
+    }
+
+    // longest string that can be stored:
+
+    size_type max_length() const nsrs_noexcept
+    {
+        return m_arena.max_record_size();
+    }
+
+    // element access, valid until the string leaves the ring:
+
+    value_type operator[]( size_type idx ) const nsrs_noexcept
+    {
+        return view_( m_slots[idx] );
+    }
+
+    value_type front() const nsrs_noexcept
+    {
+        return view_( m_slots.front() );
+    }
+
+    value_type back() const nsrs_noexcept
+    {
+        return view_( m_slots.back() );
+    }
+
+    // modifiers; false if the string is longer than max_length():
+
+    bool push_back( value_type str ) nsrs_noexcept
+    {
+        if ( str.size() > InlineSize && str.size() > max_length() )
+            return false;
+
+        if ( m_slots.full() )
+            pop_front();
+
+        slot_ slot;
+        slot.size = str.size();
+
+        if ( str.size() <= InlineSize )
+        {
+            str.copy( slot.chars, str.size() );
+        }
+        else
+        {
+            while ( ! m_arena.push( str.data(), str.size() ) )
+            {
+                if ( m_slots.empty() )
+                    return false;
+
+                pop_front();
+            }
+
+            slot.spilled = reinterpret_cast<char const *>( m_arena.back().first );
+        }
+
+        m_slots.commit_back( 1 );
+        m_slots.back() = slot;
+        return true;
+    }
+
+    void pop_front() nsrs_noexcept
+    {
+        assert( ! empty() );
+
+        if ( m_slots.front().size > InlineSize )
+            m_arena.pop();
+
+        m_slots.consume_front( 1 );
+    }
+
+    void clear() nsrs_noexcept
+    {
+        m_slots.consume_front( m_slots.size() );
+        m_arena.clear();
+    }
+
+private:
+    struct slot_
+    {
+        size_type       size;
+        union
+        {
+            char        chars[ InlineSize ];
+            char const *spilled;
+        };
+    };
+
+    static value_type view_( slot_ const & slot ) nsrs_noexcept
+    {
+        return value_type( slot.size <= InlineSize ? slot.chars : slot.spilled, slot.size );
+    }
+
+private:
+    std::vector<slot_>              m_slot_storage;
+    ring_span<slot_>                m_slots;
+    std::vector<char>               m_arena_storage;
+    record_ring                     m_arena;
+};
+
+typedef basic_string_ring<> string_ring;
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::basic_string_ring;
+using ring_span_lite::string_ring;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_STRING_RING
+
+#endif // NONSTD_STRING_RING_LITE_HPP
@@ -0,0 +1,171 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_WORK_STEALING_DEQUE_LITE_HPP
+#define NONSTD_WORK_STEALING_DEQUE_LITE_HPP
+
+#include <nonstd/ring_span.hpp>
+
+// Bounded Chase-Lev work-stealing deque (C++11):
+
+#if nsrs_CPP11_OR_GREATER
+# define nsrs_HAVE_WORK_STEALING_DEQUE  1
+#else
+# define nsrs_HAVE_WORK_STEALING_DEQUE  0
+#endif
+
+#if nsrs_HAVE_WORK_STEALING_DEQUE
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace nonstd { namespace ring_span_lite {
+
+//
+// work_stealing_deque: the owner pushes and pops at the bottom, thieves steal from the top.
+//
+// Chase-Lev deque over a contiguous range with a power-of-2 size, indexed with
+// a mask. The owner's push() and pop() use plain loads and stores, except for
+// a compare-and-swap when pop() competes with thieves for the last element.
+// Thieves claim the top element with a compare-and-swap. A thief may read an
+// element that is overwritten before its claim fails, hence T must be
+// trivially copyable. The deque does not grow: push() fails when it is full.
+//
+template< class T >
+class work_stealing_deque
+{
+    static_assert( std::is_trivially_copyable<T>::value,
+        "work_stealing_deque requires a trivially copyable element type" );
+
+public:
+    typedef T               value_type;
+    typedef std::size_t     size_type;
+
+    template< class ContiguousIterator >
+    work_stealing_deque( ContiguousIterator begin, ContiguousIterator end )
+        : m_data  ( &* begin )
+        , m_mask  ( static_cast<index_type>( end - begin ) - 1 )
+        , m_top   ( 0 )
+        , m_bottom( 0 )
+    {
+        assert( detail::is_power_of_2( capacity() ) );
+    }
+
+    work_stealing_deque( work_stealing_deque const & ) = delete;
+    work_stealing_deque & operator=( work_stealing_deque const & ) = delete;
+
+    // observers, approximate while thieves are active:
+
+    size_type capacity() const nsrs_noexcept
+    {
+        return static_cast<size_type>( m_mask + 1 );
+    }
+
+    size_type size() const nsrs_noexcept
+    {
+        index_type const b = m_bottom.load( std::memory_order_relaxed );
+        index_type const t = m_top   .load( std::memory_order_relaxed );
+
+        return static_cast<size_type>( b > t ? b - t : 0 );
+    }
+
+    bool empty() const nsrs_noexcept
+    {
+        return size() == 0;
+    }
+
+    // owner side:
+
+    bool push( T const & value ) nsrs_noexcept
+    {
+        index_type const b = m_bottom.load( std::memory_order_relaxed );
+        index_type const t = m_top   .load( std::memory_order_acquire );
+
+        if ( b - t > m_mask )
+            return false;
+
+        slot_( b ) = value;
+        std::atomic_thread_fence( std::memory_order_release );
+        m_bottom.store( b + 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    bool pop( T & value ) nsrs_noexcept
+    {
+        index_type const b = m_bottom.load( std::memory_order_relaxed ) - 1;
+
+        m_bottom.store( b, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+
+        index_type t = m_top.load( std::memory_order_relaxed );
+
+        if ( t > b )
+        {
+            m_bottom.store( b + 1, std::memory_order_relaxed );
+            return false;
+        }
+
+        value = slot_( b );
+
+        if ( t < b )
+            return true;
+
+        // last element: race thieves for it:
+
+        bool const won = m_top.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+
+        m_bottom.store( b + 1, std::memory_order_relaxed );
+        return won;
+    }
+
+    // thief side; false if empty or if another thread claimed the element first:
+
+    bool steal( T & value ) nsrs_noexcept
+    {
+        index_type t = m_top.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        index_type const b = m_bottom.load( std::memory_order_acquire );
+
+        if ( t >= b )
+            return false;
+
+        value = slot_( t );
+
+        return m_top.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+    }
+
+private:
+    typedef std::int64_t index_type;
+
+    T & slot_( index_type idx ) const nsrs_noexcept
+    {
+        return m_data[ static_cast<size_type>( idx & m_mask ) ];
+    }
+
+private:
+    T *                     m_data;
+    index_type              m_mask;
+    char                    m_pad0[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<index_type> m_top;      // advanced by thieves and by owner taking the last element
+    char                    m_pad1[ nsrs_CONFIG_CACHELINE_SIZE ];
+    std::atomic<index_type> m_bottom;   // written by owner
+    char                    m_pad2[ nsrs_CONFIG_CACHELINE_SIZE ];
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::work_stealing_deque;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_WORK_STEALING_DEQUE
+
+#endif // NONSTD_WORK_STEALING_DEQUE_LITE_HPP
@@ -0,0 +1,322 @@
+//
+// Copyright 2026-2026 by Martin Moene
+//
+// https://github.com/martinmoene/ring-span-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_WORK_STEALING_POOL_LITE_HPP
+#define NONSTD_WORK_STEALING_POOL_LITE_HPP
+
+#include <nonstd/work_stealing_deque.hpp>
+
+// Thread pool with per-worker work-stealing deques and a global injection ring (C++11):
+
+#if nsrs_HAVE_WORK_STEALING_DEQUE
+# define nsrs_HAVE_WORK_STEALING_POOL  1
+#else
+# define nsrs_HAVE_WORK_STEALING_POOL  0
+#endif
+
+#if nsrs_HAVE_WORK_STEALING_POOL
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nonstd { namespace ring_span_lite {
+
+// Task: a function and its argument, trivially copyable to live in the rings.
+
+struct pool_task
+{
+    void (*function)( void * );
+    void * argument;
+};
+
+//
+// work_stealing_pool: reference thread pool.
+//
+// Each worker owns a lock-free work_stealing_deque and runs the tasks it
+// submits itself last-in first-out. Tasks submitted from other threads go
+// into a bounded global injection ring (a ring_span guarded by a mutex),
+// from which an idle worker takes a batch at a time. A worker without local
+// or injected work steals from the other workers. Workers sleep only while no
+// task is outstanding. The destructor waits for all outstanding tasks.
+//
+class work_stealing_pool
+{
+public:
+    typedef std::size_t size_type;
+
+    explicit work_stealing_pool(
+        size_type workers         = std::thread::hardware_concurrency()
+      , size_type local_capacity  = 1024      // power of 2
+      , size_type global_capacity = 4096
+    )
+        : m_global_storage( global_capacity )
+        , m_global( m_global_storage.begin(), m_global_storage.end() )
+        , m_pending( 0 )
+        , m_sleepers( 0 )
+        , m_stop( false )
+    {
+        workers = workers > 0 ? workers : 1;
+
+        for ( size_type i = 0; i < workers; ++i )
+            m_workers.push_back( std::unique_ptr<worker_>( new worker_( local_capacity, i ) ) );
+
+        for ( size_type i = 0; i < workers; ++i )
+            m_workers[i]->thread = std::thread( &work_stealing_pool::run_, this, m_workers[i].get() );
+    }
+
+    ~work_stealing_pool()
+    {
+        wait_idle();
+
+        {
+            std::lock_guard<std::mutex> lock( m_sleep_mutex );
+            m_stop.store( true );
+        }
+        m_wakeup.notify_all();
+
+        for ( size_type i = 0; i < m_workers.size(); ++i )
+            m_workers[i]->thread.join();
+    }
+
+    work_stealing_pool( work_stealing_pool const & ) = delete;
+    work_stealing_pool & operator=( work_stealing_pool const & ) = delete;
+
+    // observers:
+
+    size_type workers() const nsrs_noexcept
+    {
+        return m_workers.size();
+    }
+
+    // number of tasks submitted and not yet finished:
+
+    size_type pending() const nsrs_noexcept
+    {
+        return m_pending.load();
+    }
+
+    // submit a task; yield while the injection ring is full:
+
+    void submit( pool_task const & task )
+    {
+        submit( &task, &task + 1 );
+    }
+
+    // submit a batch of tasks, taking the injection lock once per ring-full:
+
+    void submit( pool_task const * first, pool_task const * last )
+    {
+        if ( first == last )
+            return;
+
+        m_pending.fetch_add( static_cast<size_type>( last - first ) );
+
+        worker_ * const self = current_();
+
+        if ( self && self->pool == this )
+        {
+            for ( ; first != last && self->deque.push( *first ); ++first )
+                ;
+        }
+
+        while ( first != last )
+        {
+            {
+                std::lock_guard<std::mutex> lock( m_global_mutex );
+
+                for ( ; first != last && !m_global.full(); ++first )
+                    m_global.push_back( *first );
+            }
+
+            if ( first != last )
+            {
+                wake_();
+
+                // a worker with a full deque runs the task itself:
+
+                if ( self && self->pool == this )
+                    execute_( *first++ );
+                else
+                    std::this_thread::yield();
+            }
+        }
+
+        wake_();
+    }
+
+    // run tasks (from a worker) or yield (from another thread) until done() is true:
+
+    template< class Predicate >
+    void help_until( Predicate done )
+    {
+        worker_ * const self = current_();
+
+        while ( !done() )
+        {
+            if ( !( self && self->pool == this && run_one_( *self ) ) )
+                std::this_thread::yield();
+        }
+    }
+
+    // wait until all outstanding tasks have finished:
+
+    void wait_idle()
+    {
+        help_until( [this]() { return m_pending.load() == 0; } );
+    }
+
+private:
+    struct worker_
+    {
+        worker_( size_type capacity, size_type index_ )
+            : storage( capacity )
+            , deque( storage.begin(), storage.end() )
+            , pool( nsrs_nullptr )
+            , index( index_ )
+            , seed( static_cast<std::uint32_t>( 2 * index_ + 1 ) )
+        {}
+
+        std::vector<pool_task>          storage;
+        work_stealing_deque<pool_task>  deque;
+        work_stealing_pool *            pool;
+        size_type                       index;
+        std::uint32_t                   seed;       // victim selection
+        std::thread                     thread;
+    };
+
+    static worker_ *& current_() nsrs_noexcept
+    {
+        static thread_local worker_ * current = nsrs_nullptr;
+        return current;
+    }
+
+    void run_( worker_ * self )
+    {
+        self->pool = this;
+        current_() = self;
+
+        while ( !m_stop.load() )
+        {
+            if ( run_one_( *self ) )
+                continue;
+
+            if ( m_pending.load() > 0 )
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock( m_sleep_mutex );
+            ++m_sleepers;
+            m_wakeup.wait( lock, [this]() { return m_pending.load() > 0 || m_stop.load(); } );
+            --m_sleepers;
+        }
+    }
+
+    // run one task from the own deque, the injection ring or a victim:
+
+    bool run_one_( worker_ & self )
+    {
+        pool_task task;
+
+        if ( self.deque.pop( task ) || take_global_( self, task ) || steal_( self, task ) )
+        {
+            execute_( task );
+            return true;
+        }
+        return false;
+    }
+
+    // take a batch from the injection ring: run one, keep the rest locally:
+
+    bool take_global_( worker_ & self, pool_task & task )
+    {
+        std::lock_guard<std::mutex> lock( m_global_mutex );
+
+        if ( m_global.empty() )
+            return false;
+
+        task = m_global.pop_front();
+
+        size_type batch = m_global.size() / m_workers.size() + 1;
+
+        while ( batch-- > 0 && !m_global.empty() && self.deque.push( m_global.front() ) )
+            m_global.pop_front();
+
+        return true;
+    }
+
+    bool steal_( worker_ & self, pool_task & task )
+    {
+        size_type const count = m_workers.size();
+
+        if ( count < 2 )
+            return false;
+
+        // xorshift32:
+
+        self.seed ^= self.seed << 13;
+        self.seed ^= self.seed >> 17;
+        self.seed ^= self.seed << 5;
+
+        size_type const start = self.seed % count;
+
+        for ( size_type i = 0; i < count; ++i )
+        {
+            size_type const victim = ( start + i ) % count;
+
+            if ( victim != self.index && m_workers[victim]->deque.steal( task ) )
+                return true;
+        }
+        return false;
+    }
+
+    void execute_( pool_task const & task )
+    {
+        task.function( task.argument );
+        m_pending.fetch_sub( 1 );
+    }
+
+    void wake_()
+    {
+        if ( m_sleepers.load() > 0 )
+        {
+            std::lock_guard<std::mutex> lock( m_sleep_mutex );
+            m_wakeup.notify_all();
+        }
+    }
+
+private:
+    std::vector< std::unique_ptr<worker_> > m_workers;
+
+    std::mutex                              m_global_mutex;
+    std::vector<pool_task>                  m_global_storage;
+    ring_span<pool_task>                    m_global;
+
+    std::atomic<size_type>                  m_pending;
+    std::atomic<size_type>                  m_sleepers;
+    std::atomic<bool>                       m_stop;
+    std::mutex                              m_sleep_mutex;
+    std::condition_variable                 m_wakeup;
+};
+
+} // namespace ring_span_lite
+
+// Make types available in namespace nonstd:
+
+using ring_span_lite::pool_task;
+using ring_span_lite::work_stealing_pool;
+
+} // namespace nonstd
+
+#endif // nsrs_HAVE_WORK_STEALING_POOL
+
+#endif // NONSTD_WORK_STEALING_POOL_LITE_HPP
@@ -36,6 +36,7 @@ CASE( "ring-span-lite configuration" "[.ring-span][.config]" )
     nsrs_PRESENT( nsrs_HAVE_TWEAK_HEADER );
     nsrs_PRESENT( nsrs_CONFIG_STRICT_P0059 );
     nsrs_PRESENT( nsrs_CONFIG_POPPER_EMPTY_BASE_CLASS );
+    nsrs_PRESENT( nsrs_CONFIG_CACHELINE_SIZE );
     nsrs_PRESENT( nsrs_HAVE_STD_RING_SPAN );
     nsrs_PRESENT( nsrs_USES_STD_RING_SPAN );
     nsrs_PRESENT( nsrs_RING_SPAN_DEFAULT );
@@ -91,7 +92,26 @@ CASE( "Presence of C++ library features" "[.stdlibrary]" )
 #if nsrs_USES_STD_RING_SPAN
     std::cout << "(Presence of C++ library features not available: using std::ring_span)\n";
 #else
-    // none
+    nsrs_PRESENT( nsrs_HAVE_SHM_RING );
+    nsrs_PRESENT( nsrs_HAVE_RING_IO );
+    nsrs_PRESENT( nsrs_HAVE_RING_IO_ENGINE );
+    nsrs_PRESENT( nsrs_HAVE_IO_URING );
+    nsrs_PRESENT( nsrs_HAVE_RING_STREAMBUF );
+    nsrs_PRESENT( nsrs_HAVE_BROADCAST_RING );
+    nsrs_PRESENT( nsrs_HAVE_PIPELINE_RING );
+    nsrs_PRESENT( nsrs_HAVE_WORK_STEALING_DEQUE );
+    nsrs_PRESENT( nsrs_HAVE_WORK_STEALING_POOL );
+    nsrs_PRESENT( nsrs_HAVE_SOA_RING );
+    nsrs_PRESENT( nsrs_HAVE_SERIES_RING );
+    nsrs_PRESENT( nsrs_HAVE_BIT_RING );
+    nsrs_PRESENT( nsrs_HAVE_RECORD_RING );
+    nsrs_PRESENT( nsrs_HAVE_BIP_BUFFER );
+    nsrs_PRESENT( nsrs_HAVE_STRING_RING );
+    nsrs_PRESENT( nsrs_HAVE_SPSC_QUEUE );
+    nsrs_PRESENT( nsrs_HAVE_RING_POOL );
+    nsrs_PRESENT( nsrs_HAVE_RING_MAP );
+    nsrs_PRESENT( nsrs_HAVE_SEQLOCK_RING );
+    nsrs_PRESENT( nsrs_HAVE_COMBINING_RING );
 #endif
 
 #if defined _HAS_CPP0X
@@ -12,6 +12,25 @@
 
 #include "nonstd/ring.hpp"
 #include "nonstd/ring_span.hpp"
+#include "nonstd/ring_shm.hpp"
+#include "nonstd/ring_io.hpp"
+#include "nonstd/ring_io_engine.hpp"
+#include "nonstd/ring_streambuf.hpp"
+#include "nonstd/broadcast_ring.hpp"
+#include "nonstd/pipeline_ring.hpp"
+#include "nonstd/work_stealing_deque.hpp"
+#include "nonstd/work_stealing_pool.hpp"
+#include "nonstd/soa_ring.hpp"
+#include "nonstd/series_ring.hpp"
+#include "nonstd/bit_ring.hpp"
+#include "nonstd/record_ring.hpp"
+#include "nonstd/bip_buffer.hpp"
+#include "nonstd/string_ring.hpp"
+#include "nonstd/spsc_queue.hpp"
+#include "nonstd/ring_pool.hpp"
+#include "nonstd/ring_map.hpp"
+#include "nonstd/seqlock_ring.hpp"
+#include "nonstd/combining_ring.hpp"
 
 // Compiler warning suppression for usage of lest:
 
@@ -15,6 +15,8 @@
 
 #if nsrs_CPP11_OR_GREATER
 # include <array>
+# include <functional>
+# include <memory>
 #endif
 
 #include <numeric>
@@ -837,6 +839,292 @@ CASE( "ring_span: A non-full span behaves like an harmonica (front-back)" " [ext
 #endif
 }
 
+CASE( "ring_span: Allows to obtain the contiguous segments of elements" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"array_one(), array_two() are not available (SG14)" );
+#else
+    int arr[] = { 3, 4, 7, 7, 1, 2, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 4, 4 );
+
+    ring_span<int> const & crs = rs;
+
+    EXPECT( rs.array_one().first  == &arr[4] );
+    EXPECT( rs.array_one().second == 2u      );
+    EXPECT( rs.array_two().first  == &arr[0] );
+    EXPECT( rs.array_two().second == 2u      );
+
+    EXPECT( crs.array_one().first  == &arr[4] );
+    EXPECT( crs.array_two().second == 2u      );
+
+    rs.pop_front(); rs.pop_front();
+
+    EXPECT( rs.array_one().first  == &arr[0] );
+    EXPECT( rs.array_one().second == 2u      );
+    EXPECT( rs.array_two().second == 0u      );
+#endif
+}
+
+CASE( "ring_span: Allows to obtain the contiguous segments of free slots" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"free_array_one(), free_array_two() are not available (SG14)" );
+#else
+    int arr[] = { 7, 7, 1, 2, 7, 7, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 2, 2 );
+
+    EXPECT( rs.free_array_one().first  == &arr[4] );
+    EXPECT( rs.free_array_one().second == 2u      );
+    EXPECT( rs.free_array_two().first  == &arr[0] );
+    EXPECT( rs.free_array_two().second == 2u      );
+
+    rs.push_back( 3 ); rs.push_back( 4 ); rs.push_back( 5 );
+
+    EXPECT( rs.free_array_one().first  == &arr[1] );
+    EXPECT( rs.free_array_one().second == 1u      );
+    EXPECT( rs.free_array_two().second == 0u      );
+
+    rs.push_back( 6 );
+
+    EXPECT( rs.free_array_one().second == 0u      );
+    EXPECT( rs.free_array_two().second == 0u      );
+#endif
+}
+
+CASE( "ring_span: Allows to append elements written into the free segments" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"commit_back() is not available (SG14)" );
+#else
+    int arr[] = { 7, 7, 7, 7, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 3, 0 );
+
+    rs.free_array_one().first[0] = 1;
+    rs.free_array_two().first[0] = 2;
+    rs.free_array_two().first[1] = 3;
+    rs.commit_back( 3 );
+
+    int expect[] = { 1, 2, 3, };
+
+    EXPECT( rs.size() == 3u );
+    EXPECT( tst::equal( rs.begin(), rs.end(), &expect[0] ) );
+#endif
+}
+
+CASE( "ring_span: Allows to remove elements from the front, bypassing the popper" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"consume_front() is not available (SG14)" );
+#else
+    int arr[] = { 3, 7, 1, 2, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 2, 3 );
+
+    rs.consume_front( 2 );
+
+    EXPECT( rs.size()  == 1u );
+    EXPECT( rs.front() == 3  );
+    EXPECT( rs.array_one().first == &arr[0] );
+#endif
+}
+
+CASE( "ring_span: Allows to migrate the elements to a larger buffer, keeping their order" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"migrate_to() is not available (SG14)" );
+#else
+    int arr[] = { 3, 4, 1, 2, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 2, 4 );
+    int big[6] = {};
+
+    rs.migrate_to( &big[0], &big[0] + dim(big) );
+
+    int expect[] = { 1, 2, 3, 4, };
+
+    EXPECT( rs.size() == 4u );
+    EXPECT( rs.capacity() == 6u );
+    EXPECT( rs.array_one().first == &big[0] );
+    EXPECT( tst::equal( rs.begin(), rs.end(), &expect[0] ) );
+
+    rs.push_back( 5 ); rs.push_back( 6 ); rs.push_back( 7 );
+
+    EXPECT( rs.front() == 2 );
+    EXPECT( rs.back()  == 7 );
+#endif
+}
+
+CASE( "ring_span: Allows to migrate the elements to a smaller buffer, keeping the newest" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"migrate_to() is not available (SG14)" );
+#else
+    int arr[] = { 3, 4, 5, 1, 2, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 3, 5 );
+    int small[3] = {};
+
+    rs.migrate_to( &small[0], &small[0] + dim(small) );
+
+    int expect[] = { 3, 4, 5, };
+
+    EXPECT( rs.full() );
+    EXPECT( rs.capacity() == 3u );
+    EXPECT( tst::equal( rs.begin(), rs.end(), &expect[0] ) );
+#endif
+}
+
+CASE( "ring_span: Allows to clear a span, bypassing the popper" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"clear() is not available (SG14)" );
+#else
+    int arr[] = { 1, 2, 3, 4, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 2, 3 );
+
+    rs.clear();
+
+    EXPECT( rs.empty() );
+    EXPECT( rs.capacity() == 4u );
+    EXPECT( rs.free_array_one().first  == &arr[0] );
+    EXPECT( rs.free_array_one().second == 4u );
+#if nsrs_CPP11_OR_GREATER
+    EXPECT( arr[2] == 3 );      // trivially destructible: left as is
+#endif
+#endif
+}
+
+CASE( "ring_span: Allows to clear a span, releasing elements that are not trivially destructible (C++11)" " [extension]" )
+{
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+    std::shared_ptr<int> const value = std::make_shared<int>( 7 );
+    std::vector< std::shared_ptr<int> > arr( 4 );
+    ring_span< std::shared_ptr<int> > rs( arr.begin(), arr.end() );
+
+    for ( int i = 0; i < 6; ++i )
+        rs.push_back( value );
+
+    EXPECT( value.use_count() == 5 );
+
+    rs.clear();
+
+    EXPECT( rs.empty() );
+    EXPECT( value.use_count() == 1 );
+#else
+    EXPECT( !!"clear() is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring_span: Allows a compact index type to reduce the size of a span" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"IndexType is not available (SG14)" );
+#else
+    typedef ring_span<int, default_popper<int>, false, unsigned short> span16;
+    typedef ring_span<int, default_popper<int>, true , unsigned int  > span32;
+
+    EXPECT( sizeof( span16 ) <= sizeof( int * ) + 4 * sizeof( unsigned short ) );
+    EXPECT( sizeof( span32 ) <= sizeof( int * ) + 4 * sizeof( unsigned int   ) );
+    EXPECT( sizeof( span16 ) <  sizeof( ring_span<int> ) );
+
+    int arr[5] = {}; span16 rs( &arr[0], &arr[0] + dim(arr) );
+
+    for ( int i = 0; i < 8; ++i )
+        rs.push_back( i );
+
+    rs.push_front( 2 );
+    rs.pop_back();
+    rs.consume_front( 1 );
+    rs.commit_back( 1 );
+
+    EXPECT( rs.size() == 4u );
+    EXPECT( rs[0] == 3 );
+    EXPECT( rs[2] == 5 );
+    EXPECT( std::distance( rs.begin(), rs.end() ) == 4 );
+#endif
+}
+
+CASE( "ring_span: Allows to linearize the elements into a single segment" " [extension]" )
+{
+#if nsrs_CONFIG_STRICT_P0059
+    EXPECT( !!"linearize() is not available (SG14)" );
+#else
+    int arr[] = { 4, 5, 0, 1, 2, 3, }; ring_span<int> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 3, 5 );
+
+    int expect[] = { 1, 2, 3, 4, 5, };
+
+    EXPECT( rs.linearize() == &arr[0] );
+    EXPECT( rs.array_one().second == 5u );
+    EXPECT( tst::equal( &arr[0], &arr[0] + 5, &expect[0] ) );
+    EXPECT( tst::equal( rs.begin(), rs.end(), &expect[0] ) );
+#endif
+}
+
+#if nsrs_CPP11_OR_GREATER
+
+namespace {
+
+struct relocatable_widget
+{
+    std::unique_ptr<int> p;
+};
+
+} // anonymous namespace
+
+namespace nonstd { namespace ring_span_lite {
+
+template<>
+struct is_trivially_relocatable< relocatable_widget > : std::true_type {};
+
+}}
+
+#endif
+
+CASE( "is_trivially_relocatable: Includes trivially copyable types, std::unique_ptr and types that opt in (C++11)" )
+{
+#if nsrs_CPP11_OR_GREATER
+    EXPECT(  is_trivially_relocatable< int >::value );
+    EXPECT(  is_trivially_relocatable< std::unique_ptr<int> >::value );
+    EXPECT(  is_trivially_relocatable< relocatable_widget >::value );
+    EXPECT( !is_trivially_relocatable< std::function<void()> >::value );
+#else
+    EXPECT( !!"is_trivially_relocatable is not available (no C++11)" );
+#endif
+}
+
+CASE( "ring_span: Allows to linearize and migrate trivially relocatable elements bytewise (C++11)" " [extension]" )
+{
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION
+    std::vector< std::unique_ptr<int> > arr( 5 ), big( 8 );
+    ring_span< std::unique_ptr<int> > rs( arr.begin(), arr.end() );
+
+    for ( int i = 0; i < 7; ++i )
+        rs.push_back( std::unique_ptr<int>( new int( i ) ) );
+
+    rs.linearize();
+
+    EXPECT( *arr[0] == 2 );
+    EXPECT( *arr[4] == 6 );
+
+    big[7].reset( new int( 42 ) );
+    rs.migrate_to( big.begin(), big.begin() + 4 );
+
+    EXPECT( rs.size() == 4u );
+    EXPECT( *rs.front() == 3 );
+    EXPECT( *rs.back()  == 6 );
+    EXPECT( *big[7] == 42 );
+    EXPECT( *arr[0] == 2 );     // dropped on shrinking, left in place
+    EXPECT( !arr[1] );          // received the former destination value
+
+    // parts larger than the rotation buffer:
+
+    std::vector< std::unique_ptr<int> > many( 300 );
+    ring_span< std::unique_ptr<int> > rm( many.begin(), many.end() );
+
+    for ( int i = 0; i < 400; ++i )
+        rm.push_back( std::unique_ptr<int>( new int( i ) ) );
+
+    rm.linearize();
+
+    int ok = 1;
+    for ( size_t i = 0; i < many.size(); ++i )
+        if ( *many[i] != static_cast<int>( i ) + 100 ) ok = 0;
+    EXPECT( ok == 1 );
+#else
+    EXPECT( !!"trivial relocation is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
 CASE( "ring_iterator: Allows conversion to const ring_iterator" " [extension]" )
 {
 #if nsrs_CONFIG_STRICT_P0059
@@ -1085,6 +1373,62 @@ CASE( "ring_iterator: Allows to compare iterators (mixed const-non-const)" )
     EXPECT( rs.cend() >=    bgn    );
 }
 
+#if nsrs_CPP11_OR_GREATER && nsrs_RING_SPAN_LITE_EXTENSION && defined( __linux__ ) && defined( __LP64__ )
+# define nsrs_HAVE_LARGE_RING_TEST  1
+# include <sys/mman.h>
+#else
+# define nsrs_HAVE_LARGE_RING_TEST  0
+#endif
+
+CASE( "ring_iterator: Allows iterator arithmetic beyond 4G elements, keeping lower_bound O(log n)" " [extension]" )
+{
+#if nsrs_HAVE_LARGE_RING_TEST
+    typedef ring_span<unsigned char>::iterator::difference_type difference_type;
+
+    // sparse: only the pages touched are backed by memory:
+
+    std::size_t const n = ( std::size_t( 5 ) << 30 ) + 3;
+    void * const map = ::mmap( nsrs_nullptr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+
+    if ( map == MAP_FAILED )
+    {
+        EXPECT( !!"large sparse mapping is not available" );
+        return;
+    }
+
+    unsigned char * const data = static_cast<unsigned char *>( map );
+    ring_span<unsigned char> rs( data, data + n, data + ( std::size_t( 3 ) << 30 ), n );
+
+    // sorted: zeros followed by 1000 ones, wrapping around the end of the buffer:
+
+    for ( std::size_t i = n - 1000; i < n; ++i )
+        rs[i] = 1;
+
+    ring_span<unsigned char>::iterator const first = rs.begin();
+    ring_span<unsigned char>::iterator const last  = rs.end();
+    ring_span<unsigned char>::iterator pos = first + static_cast<difference_type>( n - 1000 );
+
+    EXPECT( last - first == static_cast<difference_type>( n ) );
+    EXPECT( *pos == 1 );
+    EXPECT( *( pos - 1 ) == 0 );
+    EXPECT( pos[-1] == 0 );
+
+    pos -= difference_type( 1 ) << 32;
+    EXPECT( pos - first == static_cast<difference_type>( n - 1000 ) - ( difference_type( 1 ) << 32 ) );
+
+    std::size_t compares = 0;
+    ring_span<unsigned char>::iterator const found = std::lower_bound( first, last, 1,
+        [&compares]( unsigned char element, int value ) { ++compares; return element < value; } );
+
+    EXPECT( found - first == static_cast<difference_type>( n - 1000 ) );
+    EXPECT( compares <= 40u );
+
+    ::munmap( map, n );
+#else
+    EXPECT( !!"large ring test is not available (needs C++11, 64-bit Linux, extensions)" );
+#endif
+}
+
 CASE( "null_popper: A null popper returns void" )
 {
     int arr[] = { 1, 2, 3, }; ring_span<int, null_popper<int> > rs( &arr[0], &arr[0] + dim(arr), &arr[0], dim(arr) );
@@ -1370,6 +1714,1862 @@ CASE( "ring: Allows to create data owning ring from C-array" )
     EXPECT( r.size() == count );
 }
 
+CASE( "ring: Allows to reserve capacity and shrink to fit, keeping the elements in order" " [extension]" )
+{
+#if nsrs_RING_SPAN_LITE_EXTENSION
+    ring< std::vector<int> > r( 3 );
+
+    r.push_back( 1 ); r.push_back( 2 ); r.push_back( 3 ); r.push_back( 4 );    // wraps
+
+    r.reserve( 10 );
+
+    EXPECT( r.capacity() == 10u );
+    EXPECT( r.size() == 3u );
+    EXPECT( r[0] == 2 );
+    EXPECT( r[1] == 3 );
+    EXPECT( r[2] == 4 );
+
+    r.reserve( 5 );
+    EXPECT( r.capacity() == 10u );
+
+    r.shrink_to_fit();
+    EXPECT( r.capacity() == 3u );
+    EXPECT( r.front() == 2 );
+    EXPECT( r.back()  == 4 );
+#else
+    EXPECT( !!"ring capacity management is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring: Allows to grow on a full push instead of overwriting" " [extension]" )
+{
+#if nsrs_RING_SPAN_LITE_EXTENSION
+    ring< std::vector<int>, true > r( 2 );
+
+    EXPECT_NOT( r.auto_grow() );
+    r.set_auto_grow( true );
+    EXPECT( r.auto_grow() );
+
+    r.push_back( 1 ); r.push_back( 2 ); (void) r.pop_front(); r.push_back( 3 );  // wraps
+
+    for ( int i = 4; i <= 20; ++i )
+        r.push_back( i );
+
+    r.push_front( 1 );
+    r.push_back( r.front() );   // refers into the ring while it grows
+
+    EXPECT( r.size() == 21u );
+    EXPECT( r.capacity() == 32u );
+
+    for ( size_t i = 0; i < 20; ++i )
+        EXPECT( r[i] == static_cast<int>( i ) + 1 );
+
+    EXPECT( r.back() == 1 );
+
+    r.shrink_to_fit();
+    EXPECT( r.capacity() == 32u );
+    (void) r.pop_front(); (void) r.pop_front(); (void) r.pop_front(); (void) r.pop_front(); (void) r.pop_front();
+    r.shrink_to_fit();
+    EXPECT( r.capacity() == 16u );
+    EXPECT( r.front() == 6 );
+#else
+    EXPECT( !!"ring growth is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring: Is nothrow push for a container that cannot grow" " [extension]" )
+{
+#if nsrs_RING_SPAN_LITE_EXTENSION && nsrs_CPP11_OR_GREATER
+    ring< std::array<int, 4> > a;
+    ring< std::vector<int>   > v( 4 );
+
+    EXPECT(     noexcept( a.push_back( 1 ) ) );
+    EXPECT(     noexcept( a.push_front( 1 ) ) );
+    EXPECT(     noexcept( a.emplace_back( 1 ) ) );
+    EXPECT_NOT( noexcept( v.push_back( 1 ) ) );
+    EXPECT_NOT( noexcept( v.emplace_front( 1 ) ) );
+#else
+    EXPECT( !!"noexcept push is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring: Allows to clear a ring" " [extension]" )
+{
+#if nsrs_RING_SPAN_LITE_EXTENSION
+    ring< std::vector<std::string> > r( 3 );
+
+    r.push_back( "a" ); r.push_back( "b" ); r.push_back( "c" ); r.push_back( "d" );
+    r.clear();
+
+    EXPECT( r.empty() );
+    EXPECT( r.capacity() == 3u );
+
+    r.push_back( "e" );
+    EXPECT( r.front() == "e" );
+    EXPECT( r.size() == 1u );
+#else
+    EXPECT( !!"ring::clear() is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+#if nsrs_HAVE_SHM_RING
+# include <sstream>
+# include <unistd.h>
+
+inline std::string shm_test_name( char const * tag )
+{
+    std::ostringstream os; os << "/nsrs-test-" << tag << "-" << ::getpid(); return os.str();
+}
+#endif
+
+CASE( "shm_ring: Allows to exchange elements via a named shared memory object" )
+{
+#if nsrs_HAVE_SHM_RING
+    std::string const name = shm_test_name( "named" );
+
+    shm_ring<int> producer;
+    shm_ring<int> consumer;
+
+    EXPECT( producer.create( name.c_str(), 4 ) == 0 );
+    EXPECT( consumer.attach( name.c_str() )    == 0 );
+    EXPECT( shm_ring<int>::unlink( name.c_str() ) == 0 );
+
+    EXPECT( consumer.capacity() == 4u );
+    EXPECT( consumer.empty() );
+
+    EXPECT( producer.try_push( 1 ) );
+    EXPECT( producer.try_push( 2 ) );
+    EXPECT( producer.try_push( 3 ) );
+    EXPECT( producer.try_push( 4 ) );
+    EXPECT( producer.full() );
+    EXPECT_NOT( producer.try_push( 5 ) );
+
+    int value = 0;
+
+    EXPECT( consumer.size() == 4u );
+    EXPECT( consumer.try_pop( value ) ); EXPECT( value == 1 );
+    EXPECT( consumer.try_pop( value ) ); EXPECT( value == 2 );
+    EXPECT( producer.try_push( 5 ) );
+    EXPECT( consumer.try_pop( value ) ); EXPECT( value == 3 );
+    EXPECT( consumer.try_pop( value ) ); EXPECT( value == 4 );
+    EXPECT( consumer.try_pop( value ) ); EXPECT( value == 5 );
+    EXPECT_NOT( consumer.try_pop( value ) );
+#else
+    EXPECT( !!"shm_ring is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+CASE( "shm_ring: Rejects a capacity that is not a power of 2" )
+{
+#if nsrs_HAVE_SHM_RING
+    std::string const name = shm_test_name( "pow2" );
+
+    shm_ring<int> ring;
+
+    EXPECT( ring.create( name.c_str(), 3 ) == EINVAL );
+    EXPECT_NOT( ring.valid() );
+#else
+    EXPECT( !!"shm_ring is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+CASE( "shm_ring: Rejects to attach with a different element type" )
+{
+#if nsrs_HAVE_SHM_RING
+    std::string const name = shm_test_name( "type" );
+
+    shm_ring<int>    producer;
+    shm_ring<double> consumer;
+
+    EXPECT( producer.create( name.c_str(), 8 ) == 0 );
+    EXPECT( consumer.attach( name.c_str() ) == EPROTO );
+    EXPECT( shm_ring<int>::unlink( name.c_str() ) == 0 );
+    EXPECT_NOT( consumer.valid() );
+#else
+    EXPECT( !!"shm_ring is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+CASE( "shm_ring: Allows to share a ring via a file descriptor, mapped at different addresses" )
+{
+#if nsrs_HAVE_SHM_RING
+    std::string const name = shm_test_name( "fd" );
+
+    int const fd = ::shm_open( name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+    EXPECT( fd >= 0 );
+    ::shm_unlink( name.c_str() );
+
+    shm_ring<long> a;
+    shm_ring<long> b;
+
+    EXPECT( a.create( fd, 2 ) == 0 );
+    EXPECT( b.attach( fd )    == 0 );
+    ::close( fd );
+
+    long value = 0;
+
+    EXPECT( a.try_push( 42L ) );
+    EXPECT( b.try_pop( value ) );
+    EXPECT( value == 42L );
+    EXPECT( a.empty() );
+#else
+    EXPECT( !!"shm_ring is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+#if nsrs_HAVE_RING_IO
+# include <cstring>
+# include <unistd.h>
+#endif
+
+CASE( "ring_io: Allows to read from a file descriptor into the free segments of a byte ring" )
+{
+#if nsrs_HAVE_RING_IO
+    int fds[2]; EXPECT( ::pipe( fds ) == 0 );
+    EXPECT( ::write( fds[1], "abcdef", 6 ) == 6 );
+
+    char arr[8] = {}; ring_span<char> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 5, 0 );
+
+    EXPECT( read_into( fds[0], rs ) == 6 );
+    EXPECT( rs.size() == 6u );
+    EXPECT( std::memcmp( &arr[5], "abc", 3 ) == 0 );
+    EXPECT( std::memcmp( &arr[0], "def", 3 ) == 0 );
+
+    EXPECT( ::write( fds[1], "ghij", 4 ) == 4 );
+    EXPECT( read_into( fds[0], rs ) == 2 );
+    EXPECT( rs.full() );
+    EXPECT( read_into( fds[0], rs ) == -1 );
+    EXPECT( errno == ENOBUFS );
+
+    ::close( fds[0] ); ::close( fds[1] );
+#else
+    EXPECT( !!"read_into() is not available (no POSIX, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring_io: Allows to write the elements of a byte ring to a file descriptor" )
+{
+#if nsrs_HAVE_RING_IO
+    int fds[2]; EXPECT( ::pipe( fds ) == 0 );
+
+    char arr[] = { 'd', 'e', '?', '?', 'a', 'b', 'c', }; ring_span<char> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 4, 5 );
+
+    EXPECT( write_from( fds[1], rs ) == 5 );
+    EXPECT( rs.empty() );
+    EXPECT( write_from( fds[1], rs ) == 0 );
+
+    char buf[8] = {};
+    EXPECT( ::read( fds[0], buf, sizeof(buf) ) == 5 );
+    EXPECT( std::memcmp( buf, "abcde", 5 ) == 0 );
+
+    ::close( fds[0] ); ::close( fds[1] );
+#else
+    EXPECT( !!"write_from() is not available (no POSIX, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+#if nsrs_HAVE_RING_IO_ENGINE
+# include <cstdlib>
+# include <string>
+
+namespace io_engine {
+
+typedef ring_span<char>         byte_ring;
+typedef ring_io_engine<byte_ring> engine;
+
+// drain the rings fed by the engine until all sources reach end-of-file:
+
+inline std::vector<std::string> drain( lest::env & lest_env, engine & eng, std::vector<byte_ring *> const & rings )
+{
+    std::vector<std::string> result( rings.size() );
+
+    while ( eng.active() > 0 )
+    {
+        EXPECT( eng.run_once() >= 0 );
+
+        for ( std::size_t i = 0; i < rings.size(); ++i )
+        {
+            while ( !rings[i]->empty() )
+                result[i] += rings[i]->pop_front();
+        }
+    }
+    return result;
+}
+
+inline std::vector<std::string> pipes( lest::env & lest_env, bool force_poll )
+{
+    int a[2]; EXPECT( ::pipe( a ) == 0 );
+    int b[2]; EXPECT( ::pipe( b ) == 0 );
+
+    EXPECT( ::write( a[1], "hello, world", 12 ) == 12 ); ::close( a[1] );
+    EXPECT( ::write( b[1], "ring", 4 ) == 4 );           ::close( b[1] );
+
+    char arr_a[5]; byte_ring ra( &arr_a[0], &arr_a[0] + 5 );
+    char arr_b[8]; byte_ring rb( &arr_b[0], &arr_b[0] + 8 );
+
+    engine eng( 8, force_poll );
+    eng.add( a[0], ra );
+    eng.add( b[0], rb );
+
+    std::vector<byte_ring *> rings; rings.push_back( &ra ); rings.push_back( &rb );
+    std::vector<std::string> result = drain( lest_env, eng, rings );
+
+    EXPECT( eng.eof( 0 ) );
+    EXPECT( eng.error( 1 ) == 0 );
+
+    ::close( a[0] ); ::close( b[0] );
+    return result;
+}
+
+} // namespace io_engine
+#endif
+
+CASE( "ring_io_engine: Allows to feed rings from pipes (io_uring, if available)" )
+{
+#if nsrs_HAVE_RING_IO_ENGINE
+    std::vector<std::string> result = io_engine::pipes( lest_env, false );
+
+    EXPECT( result[0] == "hello, world" );
+    EXPECT( result[1] == "ring"         );
+#else
+    EXPECT( !!"ring_io_engine is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+CASE( "ring_io_engine: Allows to feed rings from pipes (poll)" )
+{
+#if nsrs_HAVE_RING_IO_ENGINE
+    std::vector<std::string> result = io_engine::pipes( lest_env, true );
+
+    EXPECT( result[0] == "hello, world" );
+    EXPECT( result[1] == "ring"         );
+#else
+    EXPECT( !!"ring_io_engine is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+CASE( "ring_io_engine: Allows to feed a ring from a file larger than the ring" )
+{
+#if nsrs_HAVE_RING_IO_ENGINE
+    char path[] = "/tmp/nsrs-engine-XXXXXX";
+    int const fd = ::mkstemp( path ); EXPECT( fd >= 0 ); ::unlink( path );
+
+    std::string content;
+    for ( int i = 0; i < 100; ++i )
+        content += static_cast<char>( 'a' + i % 26 );
+
+    EXPECT( ::write( fd, content.data(), content.size() ) == 100 );
+    EXPECT( ::lseek( fd, 0, SEEK_SET ) == 0 );
+
+    char arr[16]; io_engine::byte_ring ring( &arr[0], &arr[0] + 16 );
+
+    io_engine::engine eng;
+    eng.add( fd, ring );
+
+    std::vector<io_engine::byte_ring *> rings( 1, &ring );
+
+    EXPECT( io_engine::drain( lest_env, eng, rings )[0] == content );
+    ::close( fd );
+#else
+    EXPECT( !!"ring_io_engine is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+CASE( "ring_io_engine: Cancels reads in flight when destroyed" )
+{
+#if nsrs_HAVE_RING_IO_ENGINE
+    int p[2]; EXPECT( ::pipe( p ) == 0 );
+
+    char arr[8]; io_engine::byte_ring ring( &arr[0], &arr[0] + 8 );
+    {
+        io_engine::engine eng;
+        eng.add( p[0], ring );
+
+        EXPECT( eng.run_once( false ) == 0 );   // nothing to read yet
+    }
+
+    // the bytes are left for the next reader, not for the engine's ring:
+
+    EXPECT( ::write( p[1], "late", 4 ) == 4 );
+
+    char buf[8] = {};
+    EXPECT( ::read( p[0], buf, sizeof(buf) ) == 4 );
+    EXPECT( std::string( buf ) == "late" );
+    EXPECT( ring.empty() );
+
+    ::close( p[0] ); ::close( p[1] );
+#else
+    EXPECT( !!"ring_io_engine is not available (no C++11, or no POSIX)" );
+#endif
+}
+
+#if nsrs_HAVE_RING_STREAMBUF
+# include <istream>
+# include <ostream>
+#endif
+
+CASE( "ring_streambuf: Allows to format into a ring via std::ostream" )
+{
+#if nsrs_HAVE_RING_STREAMBUF
+    char arr[12]; ring_span<char> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 8, 0 );
+
+    ring_streambuf buf( rs );
+    std::ostream os( &buf );
+
+    os << "x=" << 42 << ";" << 3.5;
+    os.flush();
+
+    EXPECT( rs.size() == 8u );
+    EXPECT( std::string( rs.begin(), rs.end() ) == "x=42;3.5" );
+#else
+    EXPECT( !!"ring_streambuf is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring_streambuf: Allows to parse from a ring via std::istream" )
+{
+#if nsrs_HAVE_RING_STREAMBUF
+    char arr[] = { '3', '4', ' ', 'a', 'b', 'c', '?', '?', '1', '2', }; ring_span<char> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 8, 8 );
+
+    ring_streambuf buf( rs );
+    std::istream is( &buf );
+
+    int number = 0; std::string word;
+    is >> number >> word;
+
+    EXPECT( number == 1234  );
+    EXPECT( word   == "abc" );
+
+    buf.pubsync();
+    EXPECT( rs.empty() );
+#else
+    EXPECT( !!"ring_streambuf is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring_streambuf: Allows to write and read blocks across the wrap-around" )
+{
+#if nsrs_HAVE_RING_STREAMBUF
+    char arr[8]; ring_span<char> rs( &arr[0], &arr[0] + dim(arr), &arr[0] + 5, 0 );
+
+    ring_streambuf buf( rs );
+    std::ostream os( &buf );
+    std::istream is( &buf );
+
+    os.write( "abcdef", 6 );
+    EXPECT( os.good() );
+
+    char in[4] = {};
+    is.read( in, 4 );
+    EXPECT( std::string( in, 4 ) == "abcd" );
+
+    os.write( "ghijkl", 6 );
+    EXPECT( os.good() );
+    buf.pubsync();
+    EXPECT( rs.full() );
+    EXPECT( std::string( rs.begin(), rs.end() ) == "efghijkl" );
+#else
+    EXPECT( !!"ring_streambuf is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "ring_streambuf: Output fails when the ring is full" )
+{
+#if nsrs_HAVE_RING_STREAMBUF
+    char arr[4]; ring_span<char> rs( &arr[0], &arr[0] + dim(arr) );
+
+    ring_streambuf buf( rs );
+    std::ostream os( &buf );
+
+    os << "abc";
+    EXPECT( os.good() );
+
+    os << "de";
+    EXPECT( os.bad() );
+
+    buf.pubsync();
+    EXPECT( std::string( rs.begin(), rs.end() ) == "abcd" );
+#else
+    EXPECT( !!"ring_streambuf is not available (nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+#if nsrs_HAVE_BROADCAST_RING
+# include <thread>
+#endif
+
+CASE( "broadcast_ring: Allows each reader to receive every element" )
+{
+#if nsrs_HAVE_BROADCAST_RING
+    int arr[4] = {}; broadcast_ring<int> ring( &arr[0], &arr[0] + dim(arr), 2 );
+
+    EXPECT( ring.try_push( 1 ) );
+    EXPECT( ring.try_push( 2 ) );
+
+    int value = 0;
+    EXPECT( ring.try_pop( 0, value ) ); EXPECT( value == 1 );
+    EXPECT( ring.try_pop( 0, value ) ); EXPECT( value == 2 );
+    EXPECT_NOT( ring.try_pop( 0, value ) );
+
+    EXPECT( ring.available( 1 ) == 2u );
+    EXPECT( *ring.try_front( 1 ) == 1 ); ring.pop( 1 );
+    EXPECT( *ring.try_front( 1 ) == 2 ); ring.pop( 1 );
+    EXPECT( ring.try_front( 1 ) == nsrs_nullptr );
+#else
+    EXPECT( !!"broadcast_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "broadcast_ring: A blocking writer is gated by the slowest reader" )
+{
+#if nsrs_HAVE_BROADCAST_RING
+    int arr[4] = {}; broadcast_ring<int> ring( &arr[0], &arr[0] + dim(arr), 2 );
+
+    int value = 0;
+    for ( int i = 0; i < 4; ++i )
+    {
+        EXPECT( ring.try_push( i ) );
+        EXPECT( ring.try_pop( 0, value ) );
+    }
+
+    EXPECT_NOT( ring.try_push( 4 ) );
+
+    EXPECT( ring.try_pop( 1, value ) );
+    EXPECT( ring.try_push( 4 ) );
+    EXPECT( ring.published() == 5u );
+#else
+    EXPECT( !!"broadcast_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "broadcast_ring: An overwriting writer makes a lagging reader skip ahead and report its loss" )
+{
+#if nsrs_HAVE_BROADCAST_RING
+    int arr[4] = {}; broadcast_ring<int, broadcast_overwrite> ring( &arr[0], &arr[0] + dim(arr), 1 );
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        EXPECT( ring.try_push( i ) );
+    }
+
+    int value = 0;
+    EXPECT( ring.try_pop( 0, value ) ); EXPECT( value == 7 );
+    EXPECT( ring.dropped( 0 ) == 7u );
+    EXPECT( ring.try_pop( 0, value ) ); EXPECT( value == 8 );
+    EXPECT( ring.try_pop( 0, value ) ); EXPECT( value == 9 );
+    EXPECT_NOT( ring.try_pop( 0, value ) );
+#else
+    EXPECT( !!"broadcast_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "broadcast_ring: Allows concurrent readers to each receive every element in order" )
+{
+#if nsrs_HAVE_BROADCAST_RING
+    const int count = 20000;
+    const size_type readers = 3;
+
+    std::vector<long> arr( 64 ); broadcast_ring<long> ring( arr.begin(), arr.end(), readers );
+    std::vector<long> sums( readers );
+    std::vector<int>  ordered( readers, 1 );
+    std::vector<std::thread> threads;
+
+    for ( size_type r = 0; r < readers; ++r )
+    {
+        threads.push_back( std::thread( [&, r]()
+        {
+            long expect = 0, value = 0;
+            while ( expect < count )
+            {
+                if ( !ring.try_pop( r, value ) ) { std::this_thread::yield(); continue; }
+                if ( value != expect ) ordered[r] = 0;
+                sums[r] += value; ++expect;
+            }
+        } ) );
+    }
+
+    for ( long i = 0; i < count; ++i )
+        ring.push( i );
+
+    for ( size_type r = 0; r < readers; ++r )
+        threads[r].join();
+
+    for ( size_type r = 0; r < readers; ++r )
+    {
+        EXPECT( ordered[r] == 1 );
+        EXPECT( sums[r] == long( count ) * ( count - 1 ) / 2 );
+    }
+#else
+    EXPECT( !!"broadcast_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "pipeline_ring: Allows a stage to process an element only after its upstream stages released it" )
+{
+#if nsrs_HAVE_PIPELINE_RING
+    int arr[4] = {}; pipeline_ring<int> ring( &arr[0], &arr[0] + dim(arr) );
+
+    const size_type decode  = ring.add_stage();
+    const size_type enrich  = ring.add_stage( { decode } );
+    const size_type check   = ring.add_stage( { decode } );
+    const size_type publish = ring.add_stage( { enrich, check } );
+
+    EXPECT( ring.try_push( 1 ) );
+    EXPECT( ring.try_push( 2 ) );
+
+    EXPECT( ring.available( enrich  ) == 0u );
+    EXPECT( ring.available( publish ) == 0u );
+
+    EXPECT( ring.process( decode, []( int & x ) { x *= 10; } ) == 2u );
+    EXPECT( ring.process( enrich, []( int & x ) { x += 1; } ) == 2u );
+
+    EXPECT( ring.available( publish ) == 0u );
+
+    EXPECT( ring.available( check ) == 2u );
+    ring.release( check );
+
+    EXPECT( ring.available( publish ) == 1u );
+    EXPECT( ring[ ring.position( publish ) ] == 11 );
+#else
+    EXPECT( !!"pipeline_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "pipeline_ring: A producer is gated by the final stages" )
+{
+#if nsrs_HAVE_PIPELINE_RING
+    int arr[4] = {}; pipeline_ring<int> ring( &arr[0], &arr[0] + dim(arr) );
+
+    const size_type first = ring.add_stage();
+    const size_type last  = ring.add_stage( { first } );
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        EXPECT( ring.try_push( i ) );
+    }
+
+    EXPECT( ring.try_claim() == nsrs_nullptr );
+
+    EXPECT( ring.process( first, []( int & ) {} ) == 4u );
+    EXPECT_NOT( ring.try_push( 4 ) );
+
+    EXPECT( ring.available( last ) == 4u );
+    ring.release( last, 2 );
+
+    EXPECT( ring.try_push( 4 ) );
+    EXPECT( ring.try_push( 5 ) );
+    EXPECT_NOT( ring.try_push( 6 ) );
+    EXPECT( ring.published() == 6u );
+#else
+    EXPECT( !!"pipeline_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "pipeline_ring: Allows concurrent stages of a diamond to mutate each element in place in order" )
+{
+#if nsrs_HAVE_PIPELINE_RING
+    struct item { long value, enriched, validated; };
+
+    const long count = 20000;
+
+    std::vector<item> arr( 64 ); pipeline_ring<item> ring( arr.begin(), arr.end() );
+
+    const size_type decode   = ring.add_stage();
+    const size_type enrich   = ring.add_stage( { decode } );
+    const size_type validate = ring.add_stage( { decode } );
+    const size_type publish  = ring.add_stage( { enrich, validate } );
+
+    long sum = 0; int ok = 1;
+
+    auto run = [&]( size_type stage, std::function<void( item & )> f )
+    {
+        return std::thread( [&, stage, f]()
+        {
+            for ( long done = 0; done < count; )
+            {
+                const size_type n = ring.process( stage, f );
+                if ( n == 0 ) std::this_thread::yield();
+                done += static_cast<long>( n );
+            }
+        } );
+    };
+
+    std::vector<std::thread> threads;
+    threads.push_back( run( decode  , []( item & x ) { x.value *= 2; } ) );
+    threads.push_back( run( enrich  , []( item & x ) { x.enriched  = x.value + 1; } ) );
+    threads.push_back( run( validate, []( item & x ) { x.validated = x.value % 2 == 0; } ) );
+    threads.push_back( run( publish , [&]( item & x ) { sum += x.enriched; if ( !x.validated ) ok = 0; } ) );
+
+    for ( long i = 0; i < count; ++i )
+    {
+        item x = { i, 0, 0 };
+        ring.push( x );
+    }
+
+    for ( size_t i = 0; i < threads.size(); ++i )
+        threads[i].join();
+
+    EXPECT( ok == 1 );
+    EXPECT( sum == count * ( count - 1 ) + count );
+#else
+    EXPECT( !!"pipeline_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "work_stealing_deque: Allows the owner to push and pop at the bottom, last-in first-out" )
+{
+#if nsrs_HAVE_WORK_STEALING_DEQUE
+    int arr[4] = {}; work_stealing_deque<int> deque( &arr[0], &arr[0] + dim(arr) );
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        EXPECT( deque.push( i ) );
+    }
+
+    EXPECT_NOT( deque.push( 4 ) );
+    EXPECT( deque.size() == 4u );
+
+    int value = 0;
+    EXPECT( deque.pop( value ) ); EXPECT( value == 3 );
+    EXPECT( deque.pop( value ) ); EXPECT( value == 2 );
+    EXPECT( deque.size() == 2u );
+#else
+    EXPECT( !!"work_stealing_deque is not available (no C++11)" );
+#endif
+}
+
+CASE( "work_stealing_deque: Allows a thief to steal from the top, first-in first-out" )
+{
+#if nsrs_HAVE_WORK_STEALING_DEQUE
+    int arr[4] = {}; work_stealing_deque<int> deque( &arr[0], &arr[0] + dim(arr) );
+
+    for ( int i = 0; i < 3; ++i )
+    {
+        EXPECT( deque.push( i ) );
+    }
+
+    int value = 0;
+    EXPECT( deque.steal( value ) ); EXPECT( value == 0 );
+    EXPECT( deque.steal( value ) ); EXPECT( value == 1 );
+    EXPECT( deque.pop( value ) );   EXPECT( value == 2 );
+
+    EXPECT_NOT( deque.steal( value ) );
+    EXPECT_NOT( deque.pop( value ) );
+    EXPECT( deque.empty() );
+
+    // wraps around the storage:
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        EXPECT( deque.push( 10 + i ) );
+    }
+    EXPECT( deque.steal( value ) ); EXPECT( value == 10 );
+    EXPECT( deque.push( 14 ) );
+    EXPECT( deque.pop( value ) );   EXPECT( value == 14 );
+#else
+    EXPECT( !!"work_stealing_deque is not available (no C++11)" );
+#endif
+}
+
+CASE( "work_stealing_deque: Hands out each element exactly once to the owner and concurrent thieves" )
+{
+#if nsrs_HAVE_WORK_STEALING_DEQUE
+    const int count = 20000;
+    const int thieves = 2;
+
+    std::vector<int> arr( 64 ); work_stealing_deque<int> deque( arr.begin(), arr.end() );
+    std::vector<int> seen( count );
+    std::atomic<int> taken( 0 );
+    std::vector<std::thread> threads;
+
+    for ( int i = 0; i < thieves; ++i )
+    {
+        threads.push_back( std::thread( [&]()
+        {
+            int value = 0;
+            while ( taken.load() < count )
+            {
+                if ( deque.steal( value ) ) { ++seen[ static_cast<size_t>( value ) ]; ++taken; }
+                else std::this_thread::yield();
+            }
+        } ) );
+    }
+
+    int value = 0;
+    for ( int i = 0; i < count; )
+    {
+        if ( deque.push( i ) ) { ++i; continue; }
+        if ( deque.pop( value ) ) { ++seen[ static_cast<size_t>( value ) ]; ++taken; }
+    }
+
+    while ( taken.load() < count )
+    {
+        if ( deque.pop( value ) ) { ++seen[ static_cast<size_t>( value ) ]; ++taken; }
+    }
+
+    for ( size_t i = 0; i < threads.size(); ++i )
+        threads[i].join();
+
+    EXPECT( std::count( seen.begin(), seen.end(), 1 ) == count );
+#else
+    EXPECT( !!"work_stealing_deque is not available (no C++11)" );
+#endif
+}
+
+#if nsrs_HAVE_WORK_STEALING_POOL
+
+namespace {
+
+void count_task( void * counter )
+{
+    ++*static_cast<std::atomic<int> *>( counter );
+}
+
+struct fib_job
+{
+    work_stealing_pool * pool;
+    int n;
+    long result;
+    std::atomic<bool> done;
+};
+
+void fib_task( void * arg );
+
+void fib( fib_job & job )
+{
+    if ( job.n < 2 )
+    {
+        job.result = job.n;
+        return;
+    }
+
+    fib_job a; a.pool = job.pool; a.n = job.n - 1; a.done = false;
+    fib_job b; b.pool = job.pool; b.n = job.n - 2; b.done = false;
+
+    pool_task const task = { fib_task, &a };
+    job.pool->submit( task );
+    fib( b );
+    job.pool->help_until( [&a]() { return a.done.load(); } );
+
+    job.result = a.result + b.result;
+}
+
+void fib_task( void * arg )
+{
+    fib_job & job = *static_cast<fib_job *>( arg );
+    fib( job );
+    job.done = true;
+}
+
+} // anonymous namespace
+
+#endif // nsrs_HAVE_WORK_STEALING_POOL
+
+CASE( "work_stealing_pool: Runs each task of a batch exactly once" )
+{
+#if nsrs_HAVE_WORK_STEALING_POOL
+    std::atomic<int> counter( 0 );
+    std::vector<pool_task> tasks( 10000, pool_task() );
+
+    for ( size_t i = 0; i < tasks.size(); ++i )
+    {
+        tasks[i].function = count_task;
+        tasks[i].argument = &counter;
+    }
+
+    // injection ring smaller than the batch:
+
+    work_stealing_pool pool( 3, 64, 16 );
+
+    pool.submit( &tasks[0], &tasks[0] + tasks.size() );
+    pool.wait_idle();
+
+    EXPECT( pool.workers() == 3u );
+    EXPECT( pool.pending() == 0u );
+    EXPECT( counter.load() == 10000 );
+#else
+    EXPECT( !!"work_stealing_pool is not available (no C++11)" );
+#endif
+}
+
+CASE( "work_stealing_pool: Allows tasks to fork and join subtasks" )
+{
+#if nsrs_HAVE_WORK_STEALING_POOL
+    work_stealing_pool pool( 4, 16 );
+
+    fib_job job; job.pool = &pool; job.n = 18; job.done = false;
+    pool_task const task = { fib_task, &job };
+
+    pool.submit( task );
+    pool.help_until( [&job]() { return job.done.load(); } );
+
+    EXPECT( job.result == 2584 );
+#else
+    EXPECT( !!"work_stealing_pool is not available (no C++11)" );
+#endif
+}
+
+CASE( "soa_ring: Allows to push records and access their fields per column" )
+{
+#if nsrs_HAVE_SOA_RING
+    long ts[4]; double price[4]; int qty[4];
+    soa_ring<long, double, int> ring( 4, ts, price, qty );
+
+    EXPECT( ring.columns() == 3u );
+    EXPECT( ring.capacity() == 4u );
+
+    for ( int i = 0; i < 6; ++i )
+    {
+        ring.push_back( 100 + i, 1.5 * i, i );
+    }
+
+    EXPECT( ring.full() );
+    EXPECT( ring.get<0>( 0 ) == 102 );
+    EXPECT( ring.get<1>( 3 ) == 7.5 );
+    EXPECT( std::get<2>( ring.front() ) == 2 );
+    EXPECT( std::get<0>( ring.back()  ) == 105 );
+
+    std::get<2>( ring[1] ) = 42;
+    EXPECT( ring.get<2>( 1 ) == 42 );
+
+    ring.pop_front();
+    EXPECT( ring.size() == 3u );
+    EXPECT( ring.get<0>( 0 ) == 103 );
+#else
+    EXPECT( !!"soa_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "soa_ring: Allows to scan a single column via its contiguous segments" )
+{
+#if nsrs_HAVE_SOA_RING
+    long ts[4]; double price[4];
+    soa_ring<long, double> ring( 4, ts, price );
+
+    for ( int i = 0; i < 6; ++i )
+    {
+        ring.push_back( i, i );
+    }
+
+    const std::pair<double *, size_type> one = ring.array_one<1>();
+    const std::pair<double *, size_type> two = ring.array_two<1>();
+
+    EXPECT( one.first == &price[2] );
+    EXPECT( one.second == 2u );
+    EXPECT( two.first == &price[0] );
+    EXPECT( two.second == 2u );
+
+    double sum = std::accumulate( one.first, one.first + one.second, 0.0 );
+    sum = std::accumulate( two.first, two.first + two.second, sum );
+
+    EXPECT( sum == 2 + 3 + 4 + 5 );
+
+    soa_ring<long, double> const & cring = ring;
+    const std::pair<double const *, size_type> cone = cring.array_one<1>();
+
+    EXPECT( cone.first == one.first );
+    EXPECT( std::get<0>( cring.front() ) == 2 );
+    EXPECT( ( std::is_same< decltype( cring[0] ), std::tuple<long const &, double const &> >::value ) );
+#else
+    EXPECT( !!"soa_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "series_ring: Allows to decode the samples pushed" )
+{
+#if nsrs_HAVE_SERIES_RING
+    series_ring ring( 4, 16 );
+
+    // regular and irregular intervals, repeated, slowly and wildly changing values:
+
+    std::vector< std::pair<long long, double> > samples;
+    long long ts = 1700000000;
+    double values[] = { 12.5, 12.5, 12.75, -3.0, 1e300, 0.0, -0.0, 12.5 };
+
+    for ( int i = 0; i < 40; ++i )
+    {
+        ts += i % 5 == 0 ? 1 + i * 37 : i % 7 == 0 ? 100000 : 10;
+        samples.push_back( std::make_pair( i == 20 ? -ts : ts, values[i % 8] + i / 8 ) );
+    }
+
+    for ( size_t i = 0; i < samples.size(); ++i )
+    {
+        ring.push_back( samples[i].first, samples[i].second );
+    }
+
+    EXPECT( ring.size() == 40u );
+    EXPECT( ring.blocks() == 3u );
+
+    size_t i = 0;
+    for ( series_ring::const_iterator pos = ring.begin(); pos != ring.end(); ++pos, ++i )
+    {
+        EXPECT( pos->first  == samples[i].first  );
+        EXPECT( pos->second == samples[i].second );
+    }
+    EXPECT( i == samples.size() );
+    EXPECT( ( std::is_same< std::iterator_traits<series_ring::const_iterator>::iterator_category, std::input_iterator_tag >::value ) );
+#else
+    EXPECT( !!"series_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "series_ring: Evicts the oldest block as a whole when all blocks are in use" )
+{
+#if nsrs_HAVE_SERIES_RING
+    series_ring ring( 2, 4 );
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        ring.push_back( 60 * i, i );
+    }
+
+    EXPECT( ring.blocks() == 2u );
+    EXPECT( ring.size() == 6u );
+    EXPECT( ring.capacity() == 8u );
+    EXPECT( ring.begin()->first == 240 );
+    EXPECT( std::distance( ring.begin(), ring.end() ) == 6 );
+
+    ring.clear();
+    EXPECT( ring.empty() );
+    EXPECT( std::distance( ring.begin(), ring.end() ) == 0 );
+#else
+    EXPECT( !!"series_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "series_ring: Stores regular samples in a fraction of their size" )
+{
+#if nsrs_HAVE_SERIES_RING
+    series_ring ring( 10, 120 );
+
+    for ( int i = 0; i < 1200; ++i )
+    {
+        ring.push_back( 1700000000 + 10 * i, 50.0 + ( i % 10 ) * 0.5 );
+    }
+
+    EXPECT( ring.compressed_bytes() * 8 < ring.size() * 16 );
+#else
+    EXPECT( !!"series_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "bit_ring: Allows to push and access flags packed in words" )
+{
+#if nsrs_HAVE_BIT_RING
+    std::uint64_t words[2] = {}; bit_ring ring( &words[0], &words[0] + dim(words) );
+
+    EXPECT( ring.capacity() == 128u );
+
+    ring.push_back( true  );
+    ring.push_back( false );
+    ring.push_back( true  );
+
+    EXPECT( ring.size() == 3u );
+    EXPECT( ring.count_true() == 2u );
+    EXPECT( ring.count_false() == 1u );
+    EXPECT( ring[0] ); EXPECT_NOT( ring[1] ); EXPECT( ring.back() );
+    EXPECT( words[0] == 5u );
+
+    ring.set( 1, true );
+    ring.set( 0, false );
+    EXPECT( ring.count_true() == 2u );
+    EXPECT( words[0] == 6u );
+
+    ring.pop_front();
+    EXPECT( ring.size() == 2u );
+    EXPECT( ring.count_true() == 2u );
+#else
+    EXPECT( !!"bit_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "bit_ring: Allows to push whole words, overwriting the oldest flags when full" )
+{
+#if nsrs_HAVE_BIT_RING
+    std::uint64_t words[2] = {}; bit_ring ring( &words[0], &words[0] + dim(words) );
+
+    ring.push_word( 0x7, 4 );
+    ring.push_word( ~std::uint64_t(0) );
+    ring.push_word( 0xf0 );
+
+    EXPECT( ring.full() );
+    EXPECT( ring.count_true() == 64u + 4u );
+    EXPECT( ring[0] ); EXPECT( ring[63] );
+    EXPECT_NOT( ring[64] ); EXPECT( ring[68] );
+
+    const std::uint64_t more[2] = { 0x1, 0x3 };
+    ring.push_words( more, 2 );
+    EXPECT( ring.count_true() == 3u );
+    EXPECT( ring.front() );
+#else
+    EXPECT( !!"bit_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "bit_ring: Keeps count_true() equal to the number of set flags in the window" )
+{
+#if nsrs_HAVE_BIT_RING
+    std::uint64_t words[3] = {}; bit_ring ring( &words[0], &words[0] + dim(words) );
+    std::vector<bool> model;
+
+    std::uint64_t x = 88172645463325252ull;
+    for ( int i = 0; i < 2000; ++i )
+    {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+
+        const size_type n = 1 + static_cast<size_type>( x % 64 );
+
+        if ( x % 5 == 0 && ring.size() >= n )
+        {
+            ring.pop_front( n );
+            model.erase( model.begin(), model.begin() + static_cast<std::ptrdiff_t>( n ) );
+        }
+        else
+        {
+            ring.push_word( x, n );
+            for ( size_type k = 0; k < n; ++k )
+                model.push_back( ( ( x >> k ) & 1 ) != 0 );
+            if ( model.size() > ring.capacity() )
+                model.erase( model.begin(), model.begin() + static_cast<std::ptrdiff_t>( model.size() - ring.capacity() ) );
+        }
+    }
+
+    EXPECT( ring.size() == model.size() );
+    EXPECT( ring.count_true() == static_cast<size_type>( std::count( model.begin(), model.end(), true ) ) );
+
+    bool same = true;
+    for ( size_type k = 0; k < model.size(); ++k )
+        same = same && ring[k] == model[k];
+    EXPECT( same );
+#else
+    EXPECT( !!"bit_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "record_ring: Allows to push variable-length records and access them in place" )
+{
+#if nsrs_HAVE_RECORD_RING
+    char buf[32]; record_ring ring( &buf[0], &buf[0] + dim(buf) );
+
+    EXPECT( ring.push( std::string( "hello" ) ) );
+    EXPECT( ring.push( "", 0 ) );
+    EXPECT( ring.push( std::vector<char>( 10, 'x' ) ) );
+
+    EXPECT( ring.size() == 3u );
+    EXPECT( ring.bytes_used() == 12u + 4u + 16u );
+    EXPECT_NOT( ring.push( "y", 1 ) );
+
+    record_ring::record_type rec = ring.front();
+    EXPECT( std::string( reinterpret_cast<char const *>( rec.first ), rec.second ) == "hello" );
+    EXPECT( rec.first == reinterpret_cast<unsigned char *>( &buf[4] ) );
+
+    ring.pop();
+    EXPECT( ring.front().second == 0u );
+    ring.pop();
+    EXPECT( ring.front().second == 10u );
+    ring.pop();
+    EXPECT( ring.empty() );
+    EXPECT( ring.bytes_used() == 0u );
+#else
+    EXPECT( !!"record_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "record_ring: Keeps a payload contiguous by padding the end of the buffer" )
+{
+#if nsrs_HAVE_RECORD_RING
+    char buf[32]; record_ring ring( &buf[0], &buf[0] + dim(buf) );
+
+    EXPECT( ring.push( std::string( 8, 'a' ) ) );   // [0,12)
+    EXPECT( ring.push( std::string( 8, 'b' ) ) );   // [12,24)
+    ring.pop();
+
+    EXPECT_NOT( ring.push( std::string( 12, 'c' ) ) );
+    EXPECT( ring.push( std::string( 7, 'c' ) ) );   // pad [24,32), [0,12)
+    EXPECT( ring.bytes_used() == 12u + 8u + 12u );
+
+    record_ring::record_type rec = ring.front();
+    EXPECT( rec.first == reinterpret_cast<unsigned char *>( &buf[16] ) );
+
+    ring.pop();
+    rec = ring.front();
+    EXPECT( rec.first == reinterpret_cast<unsigned char *>( &buf[4] ) );
+    EXPECT( std::string( reinterpret_cast<char const *>( rec.first ), rec.second ) == "ccccccc" );
+    EXPECT( ring.bytes_used() == 12u );
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        const std::string msg( static_cast<size_t>( i % 9 ), char( 'a' + i % 26 ) );
+        EXPECT( ring.push( msg ) );
+        ring.pop();
+        rec = ring.front();
+        EXPECT( std::string( reinterpret_cast<char const *>( rec.first ), rec.second ) == msg );
+    }
+#else
+    EXPECT( !!"record_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "record_ring: Allows to access the newest record in place" )
+{
+#if nsrs_HAVE_RECORD_RING
+    char buf[32]; record_ring ring( &buf[0], &buf[0] + dim(buf) );
+
+    EXPECT( ring.push( std::string( 8, 'a' ) ) );
+    EXPECT( ring.push( std::string( 3, 'b' ) ) );
+
+    EXPECT( ring.back().first == reinterpret_cast<unsigned char *>( &buf[16] ) );
+    EXPECT( ring.back().second == 3u );
+#else
+    EXPECT( !!"record_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "record_ring: Limits a payload to what its 32-bit length header can express" )
+{
+#if nsrs_HAVE_RECORD_RING && nsrs_HAVE_LARGE_RING_TEST
+    // sparse: only the pages touched are backed by memory:
+
+    std::size_t const n = std::size_t( 5 ) << 30;
+    void * const map = ::mmap( nsrs_nullptr, n, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+
+    if ( map == MAP_FAILED )
+    {
+        EXPECT( !!"large sparse mapping is not available" );
+        return;
+    }
+
+    char * const data = static_cast<char *>( map );
+    record_ring ring( data, data + n );
+
+    EXPECT( ring.max_record_size() == 0xFFFFFFFEu );
+    EXPECT_NOT( ring.push( data, std::size_t( 0xFFFFFFFFu ) ) );        // the padding marker
+    EXPECT_NOT( ring.push( data, std::size_t( 1 ) << 32 ) );            // would truncate
+    EXPECT( ring.empty() );
+
+    EXPECT( ring.push( data, 3 ) );
+    EXPECT( ring.front().second == 3u );
+
+    ::munmap( map, n );
+#else
+    EXPECT( !!"large record test is not available (needs C++11, 64-bit Linux, extensions)" );
+#endif
+}
+
+CASE( "bip_buffer: Allows to reserve, commit, read and release contiguous blocks" )
+{
+#if nsrs_HAVE_BIP_BUFFER
+    char buf[10]; bip_buffer<char> bip( &buf[0], &buf[0] + dim(buf) );
+
+    char * p = bip.reserve( 8 );
+    EXPECT( p == &buf[0] );
+    std::memcpy( p, "abc", 3 );
+    bip.commit( 3 );
+
+    EXPECT( bip.read().first == &buf[0] );
+    EXPECT( bip.read().second == 3u );
+
+    bip.release( 2 );
+    EXPECT( bip.read().second == 1u );
+
+    EXPECT( bip.reserve( 8 ) == nsrs_nullptr );
+    EXPECT( bip.reserve( 7 ) == &buf[3] );
+    bip.commit( 0 );
+    EXPECT( bip.read().second == 1u );
+#else
+    EXPECT( !!"bip_buffer is not available (no C++11)" );
+#endif
+}
+
+CASE( "bip_buffer: Starts a reservation that does not fit before the end at the beginning" )
+{
+#if nsrs_HAVE_BIP_BUFFER
+    char buf[10]; bip_buffer<char> bip( &buf[0], &buf[0] + dim(buf) );
+
+    bip.reserve( 8 ); bip.commit( 8 );
+    bip.release( bip.read().second - 2 );   // [6,8) left
+
+    EXPECT( bip.reserve( 6 ) == nsrs_nullptr );
+    EXPECT( bip.reserve( 5 ) == &buf[0] );
+    bip.commit( 4 );                        // [0,4), watermark 8
+
+    EXPECT( bip.read().first == &buf[6] );
+    EXPECT( bip.read().second == 2u );
+    bip.release( 2 );
+
+    EXPECT( bip.read().first == &buf[0] );
+    EXPECT( bip.read().second == 4u );
+
+    EXPECT( bip.reserve( 6 ) == &buf[4] );
+#else
+    EXPECT( !!"bip_buffer is not available (no C++11)" );
+#endif
+}
+
+CASE( "bip_buffer: Allows a producer and a consumer thread to exchange variable-size chunks" )
+{
+#if nsrs_HAVE_BIP_BUFFER
+    const int chunks = 20000;
+
+    std::vector<unsigned> buf( 100 ); bip_buffer<unsigned> bip( buf.begin(), buf.end() );
+    int ok = 1;
+
+    std::thread consumer( [&]()
+    {
+        unsigned expect = 0;
+        while ( expect < unsigned( chunks ) * 3 )
+        {
+            const std::pair<unsigned *, size_type> block = bip.read();
+            if ( block.second == 0 ) { std::this_thread::yield(); continue; }
+            for ( size_type i = 0; i < block.second; ++i )
+                if ( block.first[i] != expect++ ) ok = 0;
+            bip.release( block.second );
+        }
+    } );
+
+    unsigned next = 0;
+    for ( int i = 0; i < chunks; ++i )
+    {
+        const size_type n = 1 + static_cast<size_type>( i % 5 );    // 1..5, 3 on average
+        unsigned * p = nsrs_nullptr;
+        while ( ( p = bip.reserve( 8 ) ) == nsrs_nullptr )
+            std::this_thread::yield();
+        for ( size_type k = 0; k < n; ++k )
+            p[k] = next++;
+        bip.commit( n );
+    }
+
+    consumer.join();
+    EXPECT( ok == 1 );
+#else
+    EXPECT( !!"bip_buffer is not available (no C++11)" );
+#endif
+}
+
+CASE( "string_ring: Allows to push short and long strings and view them" )
+{
+#if nsrs_HAVE_STRING_RING
+    basic_string_ring<8> ring( 3, 64 );
+
+    EXPECT( ring.push_back( "short" ) );
+    EXPECT( ring.push_back( "a longer string" ) );
+    EXPECT( ring.push_back( std::string( 20, 'x' ) ) );
+
+    EXPECT( ring.full() );
+    EXPECT( ring[0] == "short" );
+    EXPECT( ring[1] == "a longer string" );
+    EXPECT( ring.back() == std::string( 20, 'x' ) );
+
+    EXPECT( ring.push_back( "new" ) );
+    EXPECT( ring.size() == 3u );
+    EXPECT( ring.front() == "a longer string" );
+    EXPECT( ring.back() == "new" );
+
+    EXPECT_NOT( ring.push_back( std::string( 61, 'y' ) ) );
+    EXPECT( ring.max_length() == 60u );
+#else
+    EXPECT( !!"string_ring is not available (no C++17, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "string_ring: Drops the oldest strings while the arena has no room" )
+{
+#if nsrs_HAVE_STRING_RING
+    basic_string_ring<8> ring( 10, 64 );
+
+    EXPECT( ring.push_back( std::string( 20, 'a' ) ) );    // 24 arena bytes
+    EXPECT( ring.push_back( "tiny" ) );
+    EXPECT( ring.push_back( std::string( 20, 'b' ) ) );    // 24 arena bytes
+    EXPECT( ring.push_back( std::string( 20, 'c' ) ) );    // no room: drops 'a'
+
+    EXPECT( ring.size() == 3u );
+    EXPECT( ring.front() == "tiny" );
+    EXPECT( ring.back()  == std::string( 20, 'c' ) );
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        const std::string line = "line " + std::to_string( i ) + std::string( static_cast<size_t>( i % 30 ), '.' );
+        EXPECT( ring.push_back( line ) );
+        EXPECT( ring.back() == line );
+    }
+#else
+    EXPECT( !!"string_ring is not available (no C++17, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "string_ring: Rejects long strings if the arena has no room for any" )
+{
+#if nsrs_HAVE_STRING_RING
+    basic_string_ring<8> none( 4, 0 );
+    basic_string_ring<8> tiny( 4, 3 );
+
+    EXPECT( none.max_length() == 0u );
+    EXPECT( tiny.max_length() == 0u );
+
+    EXPECT( none.push_back( "inline" ) );
+    EXPECT( tiny.push_back( "inline" ) );
+    EXPECT_NOT( none.push_back( "longer than inline" ) );
+    EXPECT_NOT( tiny.push_back( "longer than inline" ) );
+
+    EXPECT( none.size() == 1u );
+    EXPECT( tiny.back() == "inline" );
+
+    basic_string_ring<8> no_slots( 0, 0 );
+    EXPECT( no_slots.capacity() == 0u );
+#else
+    EXPECT( !!"string_ring is not available (no C++17, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "spsc_queue: Allows to push without bound and pop in order" )
+{
+#if nsrs_HAVE_SPSC_QUEUE
+    spsc_queue<int, 4, 1> q;
+    int x = 0;
+
+    EXPECT( q.empty() );
+    EXPECT_NOT( q.try_pop( x ) );
+
+    for ( int i = 0; i < 10; ++i )
+        q.push( i );
+
+    EXPECT( q.segments() == 3u );
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        EXPECT( q.try_pop( x ) );
+        EXPECT( x == i );
+    }
+    EXPECT( q.empty() );
+#else
+    EXPECT( !!"spsc_queue is not available (no C++11)" );
+#endif
+}
+
+CASE( "spsc_queue: Reuses drained segments and keeps at most MaxFree of them" )
+{
+#if nsrs_HAVE_SPSC_QUEUE
+    spsc_queue<int, 4, 1> q;
+    int x = 0;
+
+    // steady state: no segments added once drained ones can be reused:
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        q.push( i );
+        EXPECT( q.try_pop( x ) );
+        EXPECT( x == i );
+    }
+    EXPECT( q.segments() == 2u );
+
+    // burst: grows, then trims to the live segments plus MaxFree:
+
+    for ( int i = 0; i < 40; ++i )
+        q.push( i );
+    EXPECT( q.segments() >= 10u );
+
+    for ( int i = 0; i < 40; ++i )
+        EXPECT( q.try_pop( x ) );
+
+    q.push( 1 ); q.push( 2 ); q.push( 3 ); q.push( 4 ); q.push( 5 );
+    EXPECT( q.segments() <= 3u );
+#else
+    EXPECT( !!"spsc_queue is not available (no C++11)" );
+#endif
+}
+
+CASE( "spsc_queue: Allows a producer and a consumer thread to exchange elements in order" )
+{
+#if nsrs_HAVE_SPSC_QUEUE
+    const int count = 100000;
+
+    spsc_queue<std::unique_ptr<int>, 64> q;
+    int ok = 1;
+
+    std::thread consumer( [&]()
+    {
+        std::unique_ptr<int> p;
+        for ( int expect = 0; expect < count; )
+        {
+            if ( ! q.try_pop( p ) ) { std::this_thread::yield(); continue; }
+            if ( ! p || *p != expect++ ) ok = 0;
+        }
+    } );
+
+    for ( int i = 0; i < count; ++i )
+        q.push( std::unique_ptr<int>( new int( i ) ) );
+
+    consumer.join();
+    EXPECT( ok == 1 );
+    EXPECT( q.empty() );
+#else
+    EXPECT( !!"spsc_queue is not available (no C++11)" );
+#endif
+}
+
+CASE( "ring_pool: Allows to create rings of a size class and use them as rings" )
+{
+#if nsrs_HAVE_RING_POOL
+    ring_pool<int> pool( 64, 8 );
+
+    ring_pool<int>::handle_type const a = pool.create( 3 );
+    ring_pool<int>::handle_type const b = pool.create( 8 );
+
+    EXPECT( pool.rings() == 2u );
+    EXPECT( pool.capacity( a ) == 4u );
+    EXPECT( pool.capacity( b ) == 8u );
+    EXPECT( pool.slab_used() == 12u );
+
+    for ( int i = 0; i < 6; ++i )
+    {
+        pool.push_back( a, i );
+        pool.push_back( b, 10 * i );
+    }
+
+    EXPECT( pool.full( a ) );
+    EXPECT( pool.front( a ) == 2 );
+    EXPECT( pool.back ( a ) == 5 );
+    EXPECT( pool.at( a, 1 ) == 3 );
+    EXPECT( pool.size( b ) == 6u );
+    EXPECT( pool.back( b ) == 50 );
+
+    EXPECT( pool.pop_front( a ) == 2 );
+    EXPECT( pool.pop_front( a ) == 3 );
+    EXPECT( pool.size( a ) == 2u );
+
+    pool.clear( b );
+    EXPECT( pool.empty( b ) );
+#else
+    EXPECT( !!"ring_pool is not available (no C++11)" );
+#endif
+}
+
+CASE( "ring_pool: Reuses the blocks and headers of destroyed rings, not their handles" )
+{
+#if nsrs_HAVE_RING_POOL
+    ring_pool<int> pool( 16, 3 );
+
+    ring_pool<int>::handle_type const a = pool.create( 8 );
+    ring_pool<int>::handle_type const b = pool.create( 4 );
+    ring_pool<int>::handle_type const c = pool.create( 4 );
+
+    EXPECT( pool.create( 1 ) == ring_pool<int>::npos );     // no header left
+
+    pool.destroy( b );
+    EXPECT_NOT( pool.live( b ) );
+    EXPECT( pool.create( 8 ) == ring_pool<int>::npos );     // no block of 8 left
+
+    ring_pool<int>::handle_type const d = pool.create( 3 );
+
+    EXPECT( d != b );                                       // same header, next generation
+    EXPECT( pool.live( d ) );
+    EXPECT_NOT( pool.live( b ) );
+    EXPECT( pool.slab_used() == 16u );
+    EXPECT( pool.empty( d ) );
+
+    pool.push_back( a, 1 ); pool.push_back( c, 2 ); pool.push_back( d, 3 );
+
+    int sum = 0; size_t visited = 0;
+    pool.for_each( [&]( ring_pool<int>::handle_type h ) { ++visited; sum += pool.back( h ); } );
+
+    EXPECT( visited == 3u );
+    EXPECT( sum == 6 );
+#else
+    EXPECT( !!"ring_pool is not available (no C++11)" );
+#endif
+}
+
+CASE( "ring_map: Allows to push values per key and to view the last N of them" )
+{
+#if nsrs_HAVE_RING_MAP
+    ring_map<int, int, 3> map( 4, 12 );
+
+    for ( int i = 0; i < 5; ++i )
+        map.push_back( 7, i );
+    map.push_back( 8, 42 );
+
+    EXPECT( map.size() == 2u );
+    EXPECT( map.elements() == 4u );
+    EXPECT( map.contains( 7 ) );
+    EXPECT_NOT( map.contains( 9 ) );
+
+    ring_map<int, int, 3>::view const v = map.find( 7 );
+
+    EXPECT( v.size() == 3u );
+    EXPECT( v.front() == 2 );
+    EXPECT( v[ 1 ] == 3 );
+    EXPECT( v.back() == 4 );
+    EXPECT( map.find( 8 ).back() == 42 );
+    EXPECT( map.find( 9 ).empty() );
+
+    EXPECT( map.erase( 7 ) );
+    EXPECT_NOT( map.erase( 7 ) );
+    EXPECT( map.size() == 1u );
+    EXPECT( map.elements() == 1u );
+
+    map.clear();
+    EXPECT( map.empty() );
+    EXPECT( map.elements() == 0u );
+#else
+    EXPECT( !!"ring_map is not available (no C++11)" );
+#endif
+}
+
+CASE( "ring_map: Evicts the least recently touched keys beyond max_keys or budget" )
+{
+#if nsrs_HAVE_RING_MAP
+    ring_map<int, int, 4> map( 3, 5 );
+
+    map.push_back( 1, 10 );
+    map.push_back( 2, 20 );
+    map.push_back( 3, 30 );
+    map.push_back( 1, 11 );     // touch 1: 2 is least recent
+
+    map.push_back( 4, 40 );     // beyond max_keys
+
+    EXPECT( map.size() == 3u );
+    EXPECT_NOT( map.contains( 2 ) );
+    EXPECT( map.contains( 1 ) );
+
+    map.push_back( 4, 41 );
+    map.push_back( 4, 42 );     // 6 values: beyond budget, 3 is least recent
+
+    EXPECT_NOT( map.contains( 3 ) );
+    EXPECT( map.elements() == 5u );
+    EXPECT( map.find( 1 ).size() == 2u );
+    EXPECT( map.find( 4 ).back() == 42 );
+#else
+    EXPECT( !!"ring_map is not available (no C++11)" );
+#endif
+}
+
+#if nsrs_HAVE_RING_MAP
+namespace {
+
+// all keys of a decade collide:
+
+struct decade_hash
+{
+    std::size_t operator()( int key ) const
+    {
+        return static_cast<std::size_t>( key / 10 );
+    }
+};
+
+} // anonymous namespace
+#endif
+
+CASE( "ring_map: Releases the values of evicted and erased keys" )
+{
+#if nsrs_HAVE_RING_MAP
+    ring_map<int, std::shared_ptr<int>, 2> map( 2, 4 );
+    std::shared_ptr<int> const value = std::make_shared<int>( 7 );
+
+    map.push_back( 1, value );
+    map.push_back( 1, value );
+    map.push_back( 2, value );
+    EXPECT( value.use_count() == 4 );
+
+    map.push_back( 3, nullptr );    // evicts 1
+    EXPECT( value.use_count() == 2 );
+
+    map.erase( 2 );
+    EXPECT( value.use_count() == 1 );
+#else
+    EXPECT( !!"ring_map is not available (no C++11)" );
+#endif
+}
+
+CASE( "ring_map: Allows batch upserts and keeps colliding keys reachable after erase" )
+{
+#if nsrs_HAVE_RING_MAP
+    ring_map<int, int, 2, decade_hash> map( 8, 16 );
+
+    std::vector< std::pair<int, int> > batch;
+    for ( int i = 0; i < 12; ++i )
+        batch.push_back( std::make_pair( 10 + i % 4, i ) );
+    batch.push_back( std::make_pair( 20, 99 ) );
+
+    map.push_back( batch.begin(), batch.end() );
+
+    EXPECT( map.size() == 5u );
+    EXPECT( map.elements() == 9u );
+    EXPECT( map.find( 13 ).front() == 7 );
+    EXPECT( map.find( 13 ).back() == 11 );
+
+    EXPECT( map.erase( 10 ) );
+    EXPECT( map.erase( 12 ) );
+
+    EXPECT( map.find( 11 ).back() == 9 );
+    EXPECT( map.find( 13 ).back() == 11 );
+    EXPECT( map.find( 20 ).back() == 99 );
+
+    map.push_back( 12, 5 );
+    EXPECT( map.find( 12 ).back() == 5 );
+    EXPECT( map.size() == 4u );
+#else
+    EXPECT( !!"ring_map is not available (no C++11)" );
+#endif
+}
+
+CASE( "seqlock_ring: Allows to push, pop and take snapshots oldest first" )
+{
+#if nsrs_HAVE_SEQLOCK_RING
+    int storage[ 5 ];
+    seqlock_ring<int> ring( storage, storage + 5 );
+    int snap[ 5 ];
+
+    EXPECT( ring.snapshot( snap ) == 0u );
+
+    for ( int i = 0; i < 7; ++i )
+        ring.push_back( i );
+
+    EXPECT( ring.size() == 5u );
+    EXPECT( ring.version() == 14u );
+
+    EXPECT( ring.pop_front() == 2 );
+    EXPECT( ring.pop_front() == 3 );
+
+    ring.push_back( 7 );
+
+    EXPECT( ring.snapshot( snap ) == 4u );
+    EXPECT( snap[0] == 4 );
+    EXPECT( snap[1] == 5 );
+    EXPECT( snap[2] == 6 );
+    EXPECT( snap[3] == 7 );
+#else
+    EXPECT( !!"seqlock_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "seqlock_ring: Gives readers untorn snapshots while the writer pushes and pops" )
+{
+#if nsrs_HAVE_SEQLOCK_RING
+    int const capacity = 64;
+    std::vector<int> storage( capacity );
+    seqlock_ring<int> ring( storage.begin(), storage.end() );
+
+    std::atomic<bool> done( false );
+    std::atomic<int> torn( 0 );
+
+    auto reader = [&]()
+    {
+        int snap[ capacity ];
+        int count = 0;
+
+        while ( !done.load() || count < 100 )
+        {
+            size_t const n = ring.snapshot( snap );
+
+            for ( size_t i = 1; i < n; ++i )
+                if ( snap[i] != snap[i-1] + 1 )
+                    ++torn;
+
+            ++count;
+            std::this_thread::yield();
+        }
+    };
+
+    std::thread r1( reader ), r2( reader );
+
+    for ( int i = 0; i < 200000; ++i )
+    {
+        ring.push_back( i );
+
+        if ( i % 3 == 0 )
+            (void) ring.pop_front();
+    }
+    done = true;
+
+    r1.join();
+    r2.join();
+
+    EXPECT( torn.load() == 0 );
+#else
+    EXPECT( !!"seqlock_ring is not available (no C++11)" );
+#endif
+}
+
+CASE( "combining_ring: Allows to push and pop single and bulk elements, failing when full" )
+{
+#if nsrs_HAVE_COMBINING_RING
+    combining_ring< ring< std::vector<int> > > ring( 5, 1 );
+    int const in[] = { 1, 2, 3, 4, 5, 6 };
+    int out[ 6 ] = {};
+
+    EXPECT( ring.push_back( 0, in, 3 ) == 3u );
+    EXPECT( ring.pop_front( 0, out, 2 ) == 2u );
+    EXPECT( out[0] == 1 );
+    EXPECT( out[1] == 2 );
+
+    EXPECT( ring.push_back( 0, in + 3, 3 ) == 3u );    // wraps around
+    EXPECT( ring.try_push( 0, 7 ) );
+    EXPECT_NOT( ring.try_push( 0, 8 ) );
+
+    EXPECT( ring.pop_front( 0, out, 6 ) == 5u );
+    EXPECT( out[0] == 3 );
+    EXPECT( out[3] == 6 );
+    EXPECT( out[4] == 7 );
+
+    int value = 0;
+    EXPECT_NOT( ring.try_pop( 0, value ) );
+#else
+    EXPECT( !!"combining_ring is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
+CASE( "combining_ring: Passes every element exactly once between threads" )
+{
+#if nsrs_HAVE_COMBINING_RING
+    size_t const threads = 4;
+    int const per_thread = 20000;
+
+    combining_ring< ring< std::vector<int> > > ring( 64, threads );
+    std::vector< std::vector<int> > popped( threads );
+    std::vector<std::thread> workers;
+
+    for ( size_t t = 0; t < threads; ++t )
+    {
+        workers.emplace_back( [&, t]()
+        {
+            int buffer[ 4 ];
+
+            for ( int i = 0; i < per_thread; )
+            {
+                int const value = static_cast<int>( t ) * per_thread + i;
+
+                if ( ring.try_push( t, value ) )
+                    ++i;
+
+                size_t const n = ring.pop_front( t, buffer, 1 + t % 4 );
+                popped[t].insert( popped[t].end(), buffer, buffer + n );
+            }
+        } );
+    }
+
+    for ( auto & worker : workers )
+        worker.join();
+
+    std::vector<int> all;
+    for ( auto const & values : popped )
+        all.insert( all.end(), values.begin(), values.end() );
+
+    int value = 0;
+    while ( ring.try_pop( 0, value ) )
+        all.push_back( value );
+
+    std::sort( all.begin(), all.end() );
+
+    bool exactly_once = all.size() == threads * per_thread;
+    for ( size_t i = 0; exactly_once && i < all.size(); ++i )
+        exactly_once = all[i] == static_cast<int>( i );
+
+    EXPECT( exactly_once );
+#else
+    EXPECT( !!"combining_ring is not available (no C++11, or nsrs_CONFIG_STRICT_P0059)" );
+#endif
+}
+
 CASE( "tweak header: reads tweak header if supported " "[tweak]" )
 {
 #if nsrs_HAVE_TWEAK_HEADER